@@ -1,370 +1,787 @@
 #include "CGTextureMapping.h"
 
-#include <stdbool.h>
-#include <assert.h>
+#include "CGTextureMappingKernels.h"
 
-#include "GLKMathExtensions.h"
-#include "MathExtensions.h"
 
 
+#pragma mark Scalar Kernels
 
-#pragma mark Constants
+// The baseline kernels, which every build has; the SIMD ones are each compiled by their own CGTextureMappingKernels*.cpp.
+namespace ScalarBlitKernels {
+	#include "CGTextureMappingKernels.inl"
+}
 
-static const uint8_t kInvalidBoolValue = 0xff;
+bool registerScalarBlitKernels(struct BlitKernelTable &table)
+{
+	ScalarBlitKernels::registerBlitKernels(table);
+	table.isa = CGTextureMappingISAScalar;
+	return true;
+}
 
 
-#pragma mark Macros
+#pragma mark Kernel Dispatch
 
-#define assertMessage(test, failureMessage, ...)	\
-	({	\
-		if (!(test)) {	\
-			printf("Assert! \t" failureMessage "\n", __VA_ARGS__);	\
-			assert(test);	\
-		}	\
-	})
+static const char * const kForcedISAEnvironmentVariable = "CGTEXTUREMAPPING_ISA";
 
+/// Indexed by CGTextureMappingISA.
+static const char * const kISANames[] = { "scalar", "sse4.1", "avx2", "avx512" };
+static bool (* const kRegisterBlitKernelsFunctions[])(struct BlitKernelTable &table) = {
+	registerScalarBlitKernels, registerSSE41BlitKernels, registerAVX2BlitKernels, registerAVX512BlitKernels,
+};
 
-#pragma mark Intermediate Data
+/// @return: The best ISA the CPU (and OS) supports.
+static CGTextureMappingISA supportedISA()
+{
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f"))
+		return CGTextureMappingISAAVX512;
+	if (__builtin_cpu_supports("avx2"))
+		return CGTextureMappingISAAVX2;
+	if (__builtin_cpu_supports("sse4.1"))
+		return CGTextureMappingISASSE41;
+#endif
+	return CGTextureMappingISAScalar;
+}
 
-/// `Aft`: Aft end
-/// `Fore`: Fore end
-/// `Star`: Starboard side
-/// `Port`: Port side
-struct DestImageGenInfo {
-	int srcWidth_i, srcHeight_i;
-	GLKVector2 srcSize_v2;
-	const UInt8 * srcBytes;
-	
-	GLKVector2 destSizeReciprocal_v2;
-	
-	union {
-		GLKVector2 points[4];
-		struct { GLKVector2 pointAftStar, pointAftPort, pointForeStar, pointForePort; };
-	};
+/// Picks the ISA (the best supported, unless overridden by kForcedISAEnvironmentVariable) and fills a table with its kernels, falling back to the next best if this build has none for it.
+static struct BlitKernelTable resolveBlitKernelTable()
+{
+	int isa = supportedISA();
 	
-	GLKVector2 segmentAftDelta, segmentForeDelta;
-	float segmentAftLengthSqr, segmentForeLengthSqr;
+	const char *forcedISAName = getenv(kForcedISAEnvironmentVariable);
+	if (forcedISAName != NULL) {
+		int forcedISA = -1;
+		for (int isaI = 0; isaI < (int)(sizeof(kISANames) / sizeof(kISANames[0])); ++isaI) {
+			if (strcmp(forcedISAName, kISANames[isaI]) == 0)
+				forcedISA = isaI;
+		}
+		
+		if (forcedISA < 0)
+			printf("%s (\"%s\") isn't an ISA name; ignoring it.\n", kForcedISAEnvironmentVariable, forcedISAName);
+		else if (forcedISA > isa)
+			printf("%s asks for %s, which this CPU doesn't support; using %s.\n", kForcedISAEnvironmentVariable, forcedISAName, kISANames[isa]);
+		else
+			isa = forcedISA;
+	}
 	
-	union {
-		GLKVector2 pointUVs[4];
-		/// specified in standard clockwise OpenGL quad/quadstrip order: back-right, back-left, front-right, front-left
-		struct { GLKVector2 pointUV0, pointUV1, pointUV2, pointUV3; };
-	};
-};
-
-
-#pragma mark Texture Mapping Functions
+	struct BlitKernelTable table = {};
+	while (!kRegisterBlitKernelsFunctions[isa](table))
+		--isa; // (the scalar kernels always register)
+	return table;
+}
 
-/// @return: Whether the texture coordinate could potentially be normalized (`true`), or if it was too far out of range to be handled (`false`).
-template<OutsideOfQuadUVMode tUVMode> bool isTexelCoordNormalizable(const float &coord);
-template<> inline bool isTexelCoordNormalizable<OutsideOfQuadUVWrap>(const float &coord) { return true; }
-template<> inline bool isTexelCoordNormalizable<OutsideOfQuadUVClamp>(const float &coord) { return true; }
-template<> inline bool isTexelCoordNormalizable<OutsideOfQuadUVSkip>(const float &coord)
+/// Resolved on first use, just the once (function-local statics being initialized thread-safely).
+static const struct BlitKernelTable & blitKernelTable()
 {
-	return inRange0ToJustUnder1_f(coord);
+	static const struct BlitKernelTable table = resolveBlitKernelTable();
+	return table;
 }
 
-/// @return: Whether the texture coordinate could be and was normalized (`true`), or if it was too far out of range to be handled (`false`).
-template<OutsideOfQuadUVMode tUVMode> void normalizeTexelCoord(float &coord);
-template<> inline void normalizeTexelCoord<OutsideOfQuadUVWrap>(float &coord)
-{
-	if (!inRange0ToJustUnder1_f(coord))
-		coord = modulo_f(coord, 1.0f);
+CGTextureMappingISA cgTextureMappingActiveISA(void) {
+	return blitKernelTable().isa;
 }
-template<> inline void normalizeTexelCoord<OutsideOfQuadUVClamp>(float &coord)
+
+static inline bool isPowerOfTwo(const int value)
 {
-	if (!inRange0ToJustUnder1_f(coord))
-		coord = clamp0ToJustUnder1_f(coord);
+	return (value > 0 && (value & (value - 1)) == 0);
 }
-template<> inline void normalizeTexelCoord<OutsideOfQuadUVSkip>(float &coord) { /* no-op */ }
 
-template<OutsideOfTextureSTMode tUVMode> void normalizeTexelST(float st[2]);
-template<> inline void normalizeTexelST<OutsideOfTextureSTWrap>(float st[2])
+/// @return: The active ISA's kernel for the modes & channel count, for the TexelWrapDivisor the src's size allows, and for the TexelLayout of whether there's a tiled src.
+static BlitKernel * blitKernel(QuadMappingMode mappingMode, OutsideOfQuadUVMode uvMode, OutsideOfTextureSTMode stMode, TextureFilterMode filterMode, int channelCount, int srcWidth, int srcHeight, bool hasTiledSrc)
 {
-	if (!inRange0ToJustUnder1_f(st[0]))
-		st[0] = modulo_f(st[0], 1.0f);
-	if (!inRange0ToJustUnder1_f(st[1]))
-		st[1] = modulo_f(st[1], 1.0f);
+	const TexelWrapDivisor wrapDivisor = (isPowerOfTwo(srcWidth) && isPowerOfTwo(srcHeight)) ? TexelWrapDivisorPowerOfTwo : TexelWrapDivisorMagicNumber;
+	const TexelLayout layout = hasTiledSrc ? TexelLayoutTiled : TexelLayoutLinear;
+	return blitKernelTable().kernels[mappingMode][uvMode][stMode][filterMode][wrapDivisor][layout][channelCount - 1];
 }
-template<> inline void normalizeTexelST<OutsideOfTextureSTClamp>(float st[2])
+
+
+#pragma mark Blit Entry Points
+
+/// Returned image data buffer must be freed with free() by the caller.
+template<OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, int tComponentCount, QuadMappingMode tMappingMode>
+CFDataRef cgTextureMappingBlit(
+	int srcWidth, int srcHeight, CFDataRef srcData,
+	int destWidth, int destHeight,
+	const GLKVector2 points[4], const GLKVector2 pointUVs[4],
+	DestBufferAllocator destBufferAllocator, void *destBufferAllocatorInfo,
+	int threadCount
+)
 {
-	if (!inRange0ToJustUnder1_f(st[0]))
-		st[0] = clamp0ToJustUnder1_f(st[0]);
-	if (!inRange0ToJustUnder1_f(st[1]))
-		st[1] = clamp0ToJustUnder1_f(st[1]);
+	CGTextureMappingOptions options = kDefaultCGTextureMappingOptions;
+	options.mappingMode = tMappingMode;
+	options.threadCount = threadCount;
+	
+	BlitKernel *kernel = blitKernel(tMappingMode, tUVMode, tSTMode, options.filterMode, tComponentCount, srcWidth, srcHeight, false);
+	return kernel(srcWidth, srcHeight, srcData, destWidth, destHeight, points, pointUVs, destBufferAllocator, destBufferAllocatorInfo, options);
 }
 
-/// Based on a loose understanding of Wikipedia's article on Bilinear interpolation (https://en.wikipedia.org/wiki/Bilinear_interpolation).
-/// 	Probably not the best algoritm for this— works, but with more distortion as the points become less square.
-/// 	Seems to show better results when the left and right sides of the points quad are parallel.
-template<OutsideOfQuadUVMode tUVMode>
-GLKVector2 surfaceSTToTexelUV_bilinearQuad(const struct DestImageGenInfo &info, const GLKVector2 surfaceST)
-{
-	GLKVector2 nearestPointOnAft, nearestPointOnFore;
-	float ratioAlongAft = ratioAndNearestPointAlongSegment(
-		surfaceST,
-		info.pointAftStar, info.pointAftPort,
-		info.segmentAftDelta, info.segmentAftLengthSqr,
-		&nearestPointOnAft
-	);
-	float ratioAlongFore = ratioAndNearestPointAlongSegment(
-		surfaceST,
-		info.pointForeStar, info.pointForePort,
-		info.segmentForeDelta, info.segmentForeLengthSqr,
-		&nearestPointOnFore
-	);
-	
-	float ratioAlongNearestAftToNearestFore = ratioAlongSegment(surfaceST, nearestPointOnAft, nearestPointOnFore);
-	bool vCoordValid = isTexelCoordNormalizable<tUVMode>(ratioAlongNearestAftToNearestFore);
-	if (!vCoordValid)
-		return GLKVector2Invalid;
-	
-	normalizeTexelCoord<tUVMode>(ratioAlongNearestAftToNearestFore);
-	
-	float lerpedAftForeRatios = ratioAlongAft + (ratioAlongFore - ratioAlongAft) * ratioAlongNearestAftToNearestFore;
-	bool uCoordValid = isTexelCoordNormalizable<tUVMode>(lerpedAftForeRatios);
-	if (!uCoordValid)
-		return GLKVector2Invalid;
-	
-	normalizeTexelCoord<tUVMode>(lerpedAftForeRatios);
-	
-	GLKVector2 uvOfNearestPointOnAft = GLKVector2Lerp(info.pointUV0, info.pointUV1, lerpedAftForeRatios);
-	GLKVector2 uvOfNearestPointOnFore = GLKVector2Lerp(info.pointUV2, info.pointUV3, lerpedAftForeRatios);
-	GLKVector2 texelUV = GLKVector2Lerp(uvOfNearestPointOnAft, uvOfNearestPointOnFore, ratioAlongNearestAftToNearestFore);
-	return texelUV;
-}
-
-/// @source: Real-Time Collision Detection by Christer Ericson (Morgan Kaufmann, 2005) - Chapter 3: A Math and Geometry Primer - Section 3.4 Barycentric Coordinates
-static inline GLKVector3 barycentricCoords2(const GLKVector2 point, const GLKVector2 tri[3])
-{
-	GLKVector2 v0 = GLKVector2Subtract(tri[1], tri[0]),
-		v1 = GLKVector2Subtract(tri[2], tri[0]),
-		v2 = GLKVector2Subtract(point, tri[0]);
+CFDataRef cgTextureMappingBlitWithOptions(int srcWidth, int srcHeight, CFDataRef srcData, int destWidth, int destHeight, const GLKVector2 points[4], const GLKVector2 pointUVs[4], OutsideOfQuadUVMode uvMode, OutsideOfTextureSTMode stMode, int channelCount, const CGTextureMappingOptions *options, DestBufferAllocator destBufferAllocator, void *destBufferAllocatorInfo) {
+	if (options == NULL)
+		options = &kDefaultCGTextureMappingOptions;
 	
-	float d00 = GLKVector2DotProduct(v0, v0),
-		d01 = GLKVector2DotProduct(v0, v1),
-		d11 = GLKVector2DotProduct(v1, v1),
-		d20 = GLKVector2DotProduct(v2, v0),
-		d21 = GLKVector2DotProduct(v2, v1);
+	if (!(options->mappingMode >= 0 && options->mappingMode < kQuadMappingModeCount)) {
+		assertMessage(false,
+			"The mappingMode supplied (%d) is not a valid QuadMappingMode value", options->mappingMode
+		);
+		return NULL;
+	}
+	if (!(uvMode >= 0 && uvMode < kOutsideOfQuadUVModeCount)) {
+		assertMessage(false,
+			"The uvMode supplied (%d) is not a valid OutsideOfQuadUVMode value", uvMode
+		);
+		return NULL;
+	}
+	if (!(stMode >= 0 && stMode < kOutsideOfTextureSTModeCount)) {
+		assertMessage(false,
+			"The stMode supplied (%d) is not a valid OutsideOfTextureSTMode value", stMode
+		);
+		return NULL;
+	}
+	if (!(channelCount >= 1 && channelCount <= kMaxChannelCount)) {
+		assertMessage(false,
+			"The channelCount supplied (%d) is out-of-range; must be within 1 to 4.", channelCount
+		);
+		return NULL;
+	}
+	if (!(options->fixedPointFractionBits == 0 || (options->fixedPointFractionBits >= kMinFixedPointFractionBits && options->fixedPointFractionBits <= kMaxFixedPointFractionBits))) {
+		assertMessage(false,
+			"The fixedPointFractionBits supplied (%d) is out-of-range; must be 0, or within %d to %d.", options->fixedPointFractionBits, kMinFixedPointFractionBits, kMaxFixedPointFractionBits
+		);
+		return NULL;
+	}
 	
-	float denomReciprocal = 1.0f / (d00 * d11 - d01 * d01);
-	float v = (d11 * d20 - d01 * d21) * denomReciprocal;
-	float w = (d00 * d21 - d01 * d20) * denomReciprocal;
+	if (!(options->filterMode >= 0 && options->filterMode < kTextureFilterModeCount)) {
+		assertMessage(false,
+			"The filterMode supplied (%d) is not a valid TextureFilterMode value", options->filterMode
+		);
+		return NULL;
+	}
+	if (filterModeSamplesMipChain(options->filterMode)) {
+		const struct CGTextureMappingMipChain *mipChain = options->mipChain;
+		if (mipChain == NULL) {
+			assertMessage(false,
+				"The filterMode supplied (%d) requires a mipChain.", options->filterMode
+			);
+			return NULL;
+		}
+		if (!(mipChain->levelWidths[0] == srcWidth && mipChain->levelHeights[0] == srcHeight && mipChain->channelCount == channelCount)) {
+			assertMessage(false,
+				"The mipChain supplied (%d×%d, %d channels) must be of the src (%d×%d, %d channels).", mipChain->levelWidths[0], mipChain->levelHeights[0], mipChain->channelCount, srcWidth, srcHeight, channelCount
+			);
+			return NULL;
+		}
+	}
+	if (options->filterMode == TextureFilterSummedArea) {
+		const struct CGTextureMappingSummedAreaTable *summedAreaTable = options->summedAreaTable;
+		if (summedAreaTable == NULL) {
+			assertMessage(false,
+				"The filterMode supplied (%d) requires a summedAreaTable.", options->filterMode
+			);
+			return NULL;
+		}
+		if (!(summedAreaTable->srcWidth == srcWidth && summedAreaTable->srcHeight == srcHeight && summedAreaTable->channelCount == channelCount)) {
+			assertMessage(false,
+				"The summedAreaTable supplied (%d×%d, %d channels) must be of the src (%d×%d, %d channels).", summedAreaTable->srcWidth, summedAreaTable->srcHeight, summedAreaTable->channelCount, srcWidth, srcHeight, channelCount
+			);
+			return NULL;
+		}
+	}
+	if (filterModeReadsTiledSrc(options->filterMode) && options->tiledSrc != NULL) {
+		const struct CGTextureMappingTiledSrc *tiledSrc = options->tiledSrc;
+		if (!(tiledSrc->srcWidth == srcWidth && tiledSrc->srcHeight == srcHeight && tiledSrc->channelCount == channelCount)) {
+			assertMessage(false,
+				"The tiledSrc supplied (%d×%d, %d channels) must be of the src (%d×%d, %d channels).", tiledSrc->srcWidth, tiledSrc->srcHeight, tiledSrc->channelCount, srcWidth, srcHeight, channelCount
+			);
+			return NULL;
+		}
+	}
+	if (options->filterMode == TextureFilterEWA && !(options->maxFilterTapCount >= kMinFilterTapCount && options->maxFilterTapCount <= kMaxFilterTapCount)) {
+		assertMessage(false,
+			"The maxFilterTapCount supplied (%d) is out-of-range; must be within %d to %d.", options->maxFilterTapCount, kMinFilterTapCount, kMaxFilterTapCount
+		);
+		return NULL;
+	}
+	if (options->filterMode == TextureFilterBicubic && !(options->bicubicKernel >= 0 && options->bicubicKernel < kBicubicKernelCount)) {
+		assertMessage(false,
+			"The bicubicKernel supplied (%d) is not a valid BicubicKernel value", options->bicubicKernel
+		);
+		return NULL;
+	}
+	if (!(options->destTraversal >= 0 && options->destTraversal < kDestTraversalCount)) {
+		assertMessage(false,
+			"The destTraversal supplied (%d) is not a valid DestTraversal value", options->destTraversal
+		);
+		return NULL;
+	}
 	
-	return GLKVector3Make(1.0f - v - w, v, w);
+	BlitKernel *kernel = blitKernel(options->mappingMode, uvMode, stMode, options->filterMode, channelCount, srcWidth, srcHeight, options->tiledSrc != NULL);
+	return kernel(srcWidth, srcHeight, srcData, destWidth, destHeight, points, pointUVs, destBufferAllocator, destBufferAllocatorInfo, *options);
 }
+CFDataRef cgTextureMappingBlitWithMapping(int srcWidth, int srcHeight, CFDataRef srcData, int destWidth, int destHeight, const GLKVector2 points[4], const GLKVector2 pointUVs[4], QuadMappingMode mappingMode, OutsideOfQuadUVMode uvMode, OutsideOfTextureSTMode stMode, int channelCount, DestBufferAllocator destBufferAllocator, void *destBufferAllocatorInfo) {
+	CGTextureMappingOptions options = kDefaultCGTextureMappingOptions;
+	options.mappingMode = mappingMode;
+	options.threadCount = 1;
+	return cgTextureMappingBlitWithOptions(srcWidth, srcHeight, srcData, destWidth, destHeight, points, pointUVs, uvMode, stMode, channelCount, &options, destBufferAllocator, destBufferAllocatorInfo);
+}
+CFDataRef cgTextureMappingBlit(int srcWidth, int srcHeight, CFDataRef srcData, int destWidth, int destHeight, const GLKVector2 points[4], const GLKVector2 pointUVs[4], OutsideOfQuadUVMode uvMode, OutsideOfTextureSTMode stMode, int channelCount, DestBufferAllocator destBufferAllocator, void *destBufferAllocatorInfo) {
+	return cgTextureMappingBlitWithMapping(srcWidth, srcHeight, srcData, destWidth, destHeight, points, pointUVs, QuadMappingBilinear, uvMode, stMode, channelCount, destBufferAllocator, destBufferAllocatorInfo);
+}
+
+
+
+#pragma mark Orthogonal Transforms In-Place
+
+// (not ISA-specific, so these just share the scalar kernels' helpers)
+using ScalarBlitKernels::copyBytesToPixelFromTexel;
+using ScalarBlitKernels::kCacheBlockSize;
 
-GLKVector2 surfaceSTToTexelUV_barycentricTri(const GLKVector2 surfaceST, const GLKVector2 pointSTs[3], const GLKVector2 pointUVs[3])
+template<int tComponentCount>
+inline void swapPixelBytes(UInt8 *pixelBytesA, UInt8 *pixelBytesB)
 {
-	GLKVector3 barycentricCoords = barycentricCoords2(surfaceST, pointSTs);
-	
-	GLKVector2 pointUVsPortioned[3] = {
-		GLKVector2MultiplyScalar(pointUVs[0], barycentricCoords.v[0]),
-		GLKVector2MultiplyScalar(pointUVs[1], barycentricCoords.v[1]),
-		GLKVector2MultiplyScalar(pointUVs[2], barycentricCoords.v[2])
-	};
+	UInt8 swapBytes[tComponentCount];
+	copyBytesToPixelFromTexel<tComponentCount>(swapBytes, pixelBytesA);
+	copyBytesToPixelFromTexel<tComponentCount>(pixelBytesA, pixelBytesB);
+	copyBytesToPixelFromTexel<tComponentCount>(pixelBytesB, swapBytes);
+}
+
+/// Reverses the order of the `pixelCount` pixels starting at `bytes` (a row for a horizontal flip, or the whole image for 180°).
+template<int tComponentCount>
+void reversePixelsInPlace(UInt8 *bytes, const size_t pixelCount)
+{
+	static const int kBytesPerPixel = tComponentCount;
 	
-	GLKVector2 texelUV = GLKVector2Add(GLKVector2Add(pointUVsPortioned[0], pointUVsPortioned[1]), pointUVsPortioned[2]);
-	return texelUV;
+	UInt8 *frontBytes = bytes, *backBytes = &bytes[(pixelCount - 1) * kBytesPerPixel];
+	for (; frontBytes < backBytes; frontBytes += kBytesPerPixel, backBytes -= kBytesPerPixel)
+		swapPixelBytes<tComponentCount>(frontBytes, backBytes);
 }
 
-GLKVector2 surfaceSTToTexelUV_barycentricQuad(const struct DestImageGenInfo &info, const GLKVector2 surfaceST)
+template<int tComponentCount>
+void flipHorizontalInPlace(const int width, const int height, UInt8 *bytes)
 {
-	static const int kAftStarTriInQuadIndices[3] = { 0, 1, 2 };
-	static const int kForePortTriInQuadIndices[3] = { 1, 3, 2 };
-	
-	//// @source http://stackoverflow.com/questions/1560492/how-to-tell-whether-a-point-is-to-the-right-or-left-side-of-a-line
-	float lineVsPointCross = GLKVector2CrossProduct(
-		GLKVector2Subtract(info.pointForeStar, info.pointAftPort),
-		GLKVector2Subtract(surfaceST, info.pointAftPort)
-	);
-	bool inAftStarTri = lineVsPointCross > 0.0f;
-	
-	const int *triInQuadIndices = inAftStarTri ? kAftStarTriInQuadIndices : kForePortTriInQuadIndices;
-	return surfaceSTToTexelUV_barycentricTri(
-		surfaceST,
-		(GLKVector2[3]){
-			info.points[triInQuadIndices[0]],
-			info.points[triInQuadIndices[1]],
-			info.points[triInQuadIndices[2]]
-		},
-		(GLKVector2[3]){
-			info.pointUVs[triInQuadIndices[0]],
-			info.pointUVs[triInQuadIndices[1]],
-			info.pointUVs[triInQuadIndices[2]]
-		}
-	);
+	const size_t bytesPerRow = width * tComponentCount;
+	for (int y = 0; y < height; ++y)
+		reversePixelsInPlace<tComponentCount>(&bytes[y * bytesPerRow], width);
 }
 
-template<int tComponentCount> void copyBytesToPixelFromTexel(UInt8 *texelBytes, const UInt8 *pixelBytes);
-template<> inline void copyBytesToPixelFromTexel<1>(UInt8 *pixelBytes, const UInt8 *texelBytes)
+static void flipVerticalInPlace(const size_t bytesPerRow, const int height, UInt8 *bytes)
 {
-	pixelBytes[0] = texelBytes[0];
+	UInt8 *swapRowBytes = (UInt8 *)malloc(bytesPerRow);
+	for (int y = 0; y < height / 2; ++y) {
+		UInt8 *topRowBytes = &bytes[y * bytesPerRow], *bottomRowBytes = &bytes[(height - 1 - y) * bytesPerRow];
+		memcpy(swapRowBytes, topRowBytes, bytesPerRow);
+		memcpy(topRowBytes, bottomRowBytes, bytesPerRow);
+		memcpy(bottomRowBytes, swapRowBytes, bytesPerRow);
+	}
+	free(swapRowBytes);
 }
-template<> inline void copyBytesToPixelFromTexel<2>(UInt8 *pixelBytes, const UInt8 *texelBytes)
+
+/// Transposes a square image by swapping each kCacheBlockSize tile above the diagonal with its mirror below it (both transposed as they go), so both tiles' rows stay in cache.
+template<int tComponentCount>
+void transposeSquareInPlace(const int size, UInt8 *bytes)
 {
-	pixelBytes[0] = texelBytes[0];
-	pixelBytes[1] = texelBytes[1];
+	static const int kBytesPerPixel = tComponentCount;
+	
+	const size_t bytesPerRow = size * kBytesPerPixel;
+	for (int tileY = 0; tileY < size; tileY += kCacheBlockSize) {
+		const int tileEndY = (size - tileY > kCacheBlockSize) ? tileY + kCacheBlockSize : size;
+		for (int tileX = tileY; tileX < size; tileX += kCacheBlockSize) {
+			const int tileEndX = (size - tileX > kCacheBlockSize) ? tileX + kCacheBlockSize : size;
+			for (int y = tileY; y < tileEndY; ++y) {
+				// (on the diagonal tile, only the pixels above the diagonal, so each pair is swapped once)
+				for (int x = (tileX == tileY ? y + 1 : tileX); x < tileEndX; ++x)
+					swapPixelBytes<tComponentCount>(&bytes[y * bytesPerRow + x * kBytesPerPixel], &bytes[x * bytesPerRow + y * kBytesPerPixel]);
+			}
+		}
+	}
 }
-template<> inline void copyBytesToPixelFromTexel<3>(UInt8 *pixelBytes, const UInt8 *texelBytes)
+
+/// Transposes a non-square image by following the cycles of the transpose permutation (pixel `i` of `width * height` moves to `(i * height) mod (pixelCount - 1)`), tracking which pixels are already in place with a bit per pixel.
+template<int tComponentCount>
+void transposeInPlace(const int width, const int height, UInt8 *bytes)
 {
-	pixelBytes[0] = texelBytes[0];
-	pixelBytes[1] = texelBytes[1];
-	pixelBytes[2] = texelBytes[2];
+	static const int kBytesPerPixel = tComponentCount;
+	
+	const size_t pixelCount = (size_t)width * height;
+	if (pixelCount < 3)
+		return; // (1×2 & 2×1 transposes are no-ops on the bytes)
+	const size_t lastPixelI = pixelCount - 1;
+	
+	UInt8 *pixelsInPlace = (UInt8 *)calloc((pixelCount + 7) / 8, 1);
+	for (size_t cycleStartI = 1; cycleStartI < lastPixelI; ++cycleStartI) {
+		if (pixelsInPlace[cycleStartI / 8] & (1 << (cycleStartI % 8)))
+			continue;
+		
+		UInt8 carriedBytes[kBytesPerPixel];
+		copyBytesToPixelFromTexel<tComponentCount>(carriedBytes, &bytes[cycleStartI * kBytesPerPixel]);
+		size_t pixelI = cycleStartI;
+		do {
+			pixelI = (pixelI * height) % lastPixelI;
+			swapPixelBytes<tComponentCount>(carriedBytes, &bytes[pixelI * kBytesPerPixel]);
+			pixelsInPlace[pixelI / 8] |= (1 << (pixelI % 8));
+		} while (pixelI != cycleStartI);
+	}
+	free(pixelsInPlace);
 }
-template<> inline void copyBytesToPixelFromTexel<4>(UInt8 *pixelBytes, const UInt8 *texelBytes)
+
+template<int tComponentCount>
+void cgTextureMappingOrthogonalTransformInPlace(int width, int height, UInt8 *bytes, OrthogonalTransform transform)
 {
-	pixelBytes[0] = texelBytes[0];
-	pixelBytes[1] = texelBytes[1];
-	pixelBytes[2] = texelBytes[2];
-	pixelBytes[3] = texelBytes[3];
+	const size_t bytesPerRow = width * tComponentCount;
+	
+	// the axis-swapping transforms are a transpose followed by a flip (in the transposed, `height`-wide image)
+	switch (transform) {
+		case OrthogonalTransformRotate90:
+		case OrthogonalTransformRotate270:
+		case OrthogonalTransformTranspose:
+		case OrthogonalTransformTransverse:
+			if (width == height)
+				transposeSquareInPlace<tComponentCount>(width, bytes);
+			else
+				transposeInPlace<tComponentCount>(width, height, bytes);
+			break;
+		default:
+			break;
+	}
+	
+	switch (transform) {
+		case OrthogonalTransformIdentity:
+		case OrthogonalTransformTranspose:
+			break;
+		case OrthogonalTransformRotate90:
+			flipHorizontalInPlace<tComponentCount>(height, width, bytes);
+			break;
+		case OrthogonalTransformRotate270:
+			flipVerticalInPlace(height * tComponentCount, width, bytes);
+			break;
+		case OrthogonalTransformRotate180:
+		case OrthogonalTransformTransverse:
+			reversePixelsInPlace<tComponentCount>(bytes, (size_t)width * height);
+			break;
+		case OrthogonalTransformFlipHorizontal:
+			flipHorizontalInPlace<tComponentCount>(width, height, bytes);
+			break;
+		case OrthogonalTransformFlipVertical:
+			flipVerticalInPlace(bytesPerRow, height, bytes);
+			break;
+		default:
+			assertMessage(false,
+				"The transform supplied (%d) is not a valid OrthogonalTransform value", transform
+			);
+			break;
+	}
 }
+void cgTextureMappingOrthogonalTransformInPlace(int width, int height, UInt8 *bytes, OrthogonalTransform transform, int channelCount) {
+	switch (channelCount) {
+		case 1: return cgTextureMappingOrthogonalTransformInPlace<1>(width, height, bytes, transform);
+		case 2: return cgTextureMappingOrthogonalTransformInPlace<2>(width, height, bytes, transform);
+		case 3: return cgTextureMappingOrthogonalTransformInPlace<3>(width, height, bytes, transform);
+		case 4: return cgTextureMappingOrthogonalTransformInPlace<4>(width, height, bytes, transform);
+		default:
+			assertMessage(false,
+				"The channelCount supplied (%d) is out-of-range; must be within 1 to 4.", channelCount
+			);
+			return;
+	}
+}
+
+
+
+#pragma mark Mip Chains
+
+using ScalarBlitKernels::kTilePixelCount;
+
+/// A mip level being box-filtered down from the one before it, for the TileWorkerPool: `tileRowCount` of its rows per tile.
+struct MipLevelReduction {
+	const UInt8 *srcBytes;
+	int srcWidth, srcHeight;
+	UInt8 *destBytes;
+	int destWidth, destHeight;
+	int tileRowCount;
+};
 
-template<OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, int tComponentCount>
-void genDestImagePixelBytes(const struct DestImageGenInfo &info, const int pixelX, const int pixelY, UInt8 *pixelByteBuffer)
+/// TileWork callback; `context` is a MipLevelReduction.  Each dest texel is the average (rounded to nearest) of the 2×2 src texels at twice its coords— the same texel twice along a src side that's just 1 texel.
+template<int tComponentCount>
+void reduceMipLevelTile(void *context, int tileI)
 {
 	static const int kBytesPerPixel = tComponentCount;
 	
-	const GLKVector2 &pixelST = GLKVector2Multiply(GLKVector2Make(pixelX, pixelY), info.destSizeReciprocal_v2);
-	GLKVector2 texelST = surfaceSTToTexelUV_bilinearQuad<tUVMode>(info, pixelST);
-	if (GLKVector2IsInvalid(texelST))
-		return;
+	const struct MipLevelReduction &reduction = *(const struct MipLevelReduction *)context;
+	const size_t srcBytesPerRow = (size_t)reduction.srcWidth * kBytesPerPixel, destBytesPerRow = (size_t)reduction.destWidth * kBytesPerPixel;
+	const size_t nextSrcRowByteOffset = (reduction.srcHeight > 1) ? srcBytesPerRow : 0,
+		nextSrcTexelByteOffset = (reduction.srcWidth > 1) ? kBytesPerPixel : 0;
 	
-	normalizeTexelST<tSTMode>(texelST.v);
+	const int startY = tileI * reduction.tileRowCount,
+		endY = (reduction.destHeight - startY > reduction.tileRowCount) ? startY + reduction.tileRowCount : reduction.destHeight;
+	for (int y = startY; y < endY; ++y) {
+		const UInt8 *srcRowBytes = &reduction.srcBytes[2 * y * srcBytesPerRow];
+		UInt8 *destRowBytes = &reduction.destBytes[y * destBytesPerRow];
+		for (int x = 0; x < reduction.destWidth; ++x) {
+			const UInt8 *srcTexelBytes = &srcRowBytes[2 * x * kBytesPerPixel];
+			for (int componentI = 0; componentI < tComponentCount; ++componentI) {
+				const UInt8 *srcComponent = &srcTexelBytes[componentI];
+				destRowBytes[x * kBytesPerPixel + componentI] = (UInt8)((
+					srcComponent[0] + srcComponent[nextSrcTexelByteOffset] +
+					srcComponent[nextSrcRowByteOffset] + srcComponent[nextSrcRowByteOffset + nextSrcTexelByteOffset] +
+					2
+				) >> 2);
+			}
+		}
+	}
+}
+
+/// Indexed by channel count less 1.
+static TileWork * const kReduceMipLevelTileFunctions[kMaxChannelCount] = {
+	reduceMipLevelTile<1>, reduceMipLevelTile<2>, reduceMipLevelTile<3>, reduceMipLevelTile<4>,
+};
+
+CGTextureMappingMipChainRef cgTextureMappingMipChainCreate(int srcWidth, int srcHeight, CFDataRef srcData, int channelCount, int threadCount) {
+	if (!(channelCount >= 1 && channelCount <= kMaxChannelCount)) {
+		assertMessage(false,
+			"The channelCount supplied (%d) is out-of-range; must be within 1 to 4.", channelCount
+		);
+		return NULL;
+	}
+	if (!(srcWidth >= 1 && srcHeight >= 1)) {
+		assertMessage(false,
+			"The src size supplied (%d×%d) must be at least 1×1.", srcWidth, srcHeight
+		);
+		return NULL;
+	}
+	const size_t srcByteCount = CFDataGetLength(srcData);
+	if (srcByteCount != (size_t)srcWidth * srcHeight * channelCount) {
+		assertMessage(false,
+			"Byte count of srcData (%zu) must equal the total src bytes (%zu; srcWidth (%d) * srcHeight (%d) * channelCount (%d)).",
+			srcByteCount, ((size_t)srcWidth * srcHeight * channelCount), srcWidth, srcHeight, channelCount
+		);
+		return NULL;
+	}
 	
-	GLKVector2 texelXY = GLKVector2Multiply(texelST, info.srcSize_v2);
-	int nearestTexelX = (texelXY.x >= 0.0f) ? (int)texelXY.x : ((int)texelXY.x - 1),
-		nearestTexelY = (texelXY.y >= 0.0f) ? (int)texelXY.y : ((int)texelXY.y - 1);
+	struct CGTextureMappingMipChain *mipChain = (struct CGTextureMappingMipChain *)calloc(1, sizeof(struct CGTextureMappingMipChain));
+	mipChain->channelCount = channelCount;
+	mipChain->srcData = (CFDataRef)CFRetain(srcData);
 	
-	const int texelIndex = nearestTexelY * info.srcWidth_i + nearestTexelX;
-	const UInt8 *texelBytes = &info.srcBytes[texelIndex * kBytesPerPixel];
+	// every level's size (and where it goes in the one buffer) first
+	size_t levelByteOffsets[kMaxMipLevelCount], reducedByteCount = 0;
+	mipChain->levelWidths[0] = srcWidth;
+	mipChain->levelHeights[0] = srcHeight;
+	mipChain->levelCount = 1;
+	for (int levelI = 1; mipChain->levelWidths[levelI - 1] > 1 || mipChain->levelHeights[levelI - 1] > 1; ++levelI) {
+		const int width = (mipChain->levelWidths[levelI - 1] > 1) ? mipChain->levelWidths[levelI - 1] / 2 : 1,
+			height = (mipChain->levelHeights[levelI - 1] > 1) ? mipChain->levelHeights[levelI - 1] / 2 : 1;
+		mipChain->levelWidths[levelI] = width;
+		mipChain->levelHeights[levelI] = height;
+		levelByteOffsets[levelI] = reducedByteCount;
+		reducedByteCount += (size_t)width * height * channelCount;
+		mipChain->levelCount = levelI + 1;
+	}
 	
-	//UInt8 nearestTexelSample[kBytesPerPixel];
-	copyBytesToPixelFromTexel<tComponentCount>(pixelByteBuffer, texelBytes);
+	mipChain->reducedLevelBytes = (UInt8 *)malloc(reducedByteCount);
+	mipChain->levelBytes[0] = CFDataGetBytePtr(srcData);
+	for (int levelI = 1; levelI < mipChain->levelCount; ++levelI) {
+		UInt8 *levelBytes = &mipChain->reducedLevelBytes[levelByteOffsets[levelI]];
+		mipChain->levelBytes[levelI] = levelBytes;
+		
+		// (each level reads the one before, so they're each run across the threads in turn)
+		struct MipLevelReduction reduction = {
+			mipChain->levelBytes[levelI - 1], mipChain->levelWidths[levelI - 1], mipChain->levelHeights[levelI - 1],
+			levelBytes, mipChain->levelWidths[levelI], mipChain->levelHeights[levelI],
+		};
+		reduction.tileRowCount = (kTilePixelCount > reduction.destWidth) ? kTilePixelCount / reduction.destWidth : 1;
+		const int tileCount = (reduction.destHeight + reduction.tileRowCount - 1) / reduction.tileRowCount;
+		tileWorkerPoolRun(tileCount, threadCount, kReduceMipLevelTileFunctions[channelCount - 1], &reduction);
+	}
 	
-	// @debug: show UVs directly
-	//pixelByteBuffer[0] = fabsf(texelST.x) * 255.0f;
-	//pixelByteBuffer[1] = fabsf(texelST.y) * 255.0f;
-	//pixelByteBuffer[2] = (texelST.x < 0 ? 127 : 0) + (texelST.y < 0 ? 127 : 0);
-	//pixelByteBuffer[3] = 255;
+	return mipChain;
 }
+void cgTextureMappingMipChainRelease(CGTextureMappingMipChainRef mipChain) {
+	if (mipChain == NULL)
+		return;
+	
+	CFRelease(mipChain->srcData);
+	free(mipChain->reducedLevelBytes);
+	free(mipChain);
+}
+
+
+#pragma mark Summed-Area Tables
+
+/// The sums of each table row being built, for the TileWorkerPool: `tileLineCount` rows per tile in the first pass, or that many columns (of single channels' sums) in the second.
+struct SummedAreaTableBuild {
+	const UInt8 *srcBytes;
+	int srcWidth, srcHeight, channelCount;
+	uint32_t *sums;
+	int tileLineCount;
+};
+
+/// Summed-area table columns per tile for the second pass: a few KB of each row.
+static const int kSummedAreaTableTileColumnCount = 1024;
 
-UInt8 * defaultDestBufferAllocator(void *_, int pixelCount, size_t bytesPerPixel, bool *out_takeOwnership)
+/// TileWork callback; `context` is a SummedAreaTableBuild.  Fills the table row after each of the tile's src rows with the running sums along that src row (the first being 0).
+template<int tComponentCount>
+void sumSummedAreaTableRowsTile(void *context, int tileI)
 {
-	UInt8 *byteBuffer = (UInt8 *)calloc(pixelCount, bytesPerPixel); // transparent black-initialized
+	static const int kBytesPerPixel = tComponentCount;
+	
+	const struct SummedAreaTableBuild &build = *(const struct SummedAreaTableBuild *)context;
+	const size_t srcBytesPerRow = (size_t)build.srcWidth * kBytesPerPixel, sumsPerRow = (size_t)(build.srcWidth + 1) * tComponentCount;
 	
-	*out_takeOwnership = true;
-	return byteBuffer;
+	const int startY = tileI * build.tileLineCount,
+		endY = (build.srcHeight - startY > build.tileLineCount) ? startY + build.tileLineCount : build.srcHeight;
+	for (int y = startY; y < endY; ++y) {
+		const UInt8 *srcRowBytes = &build.srcBytes[y * srcBytesPerRow];
+		uint32_t *rowSums = &build.sums[(y + 1) * sumsPerRow];
+		uint32_t runningSums[tComponentCount] = {};
+		for (int componentI = 0; componentI < tComponentCount; ++componentI)
+			rowSums[componentI] = 0;
+		for (int x = 0; x < build.srcWidth; ++x) {
+			for (int componentI = 0; componentI < tComponentCount; ++componentI) {
+				runningSums[componentI] += srcRowBytes[x * kBytesPerPixel + componentI];
+				rowSums[(x + 1) * tComponentCount + componentI] = runningSums[componentI];
+			}
+		}
+	}
 }
 
-/// Returned image data buffer must be freed with free() by the caller.
-template<OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, int tComponentCount>
-CFDataRef cgTextureMappingBlit(
-	int srcWidth, int srcHeight, CFDataRef srcData,
-	int destWidth, int destHeight,
-	const GLKVector2 points[4], const GLKVector2 pointUVs[4],
-	DestBufferAllocator destBufferAllocator, void *destBufferAllocatorInfo
-)
+/// Indexed by channel count less 1.
+static TileWork * const kSumSummedAreaTableRowsTileFunctions[kMaxChannelCount] = {
+	sumSummedAreaTableRowsTile<1>, sumSummedAreaTableRowsTile<2>, sumSummedAreaTableRowsTile<3>, sumSummedAreaTableRowsTile<4>,
+};
+
+/// TileWork callback; `context` is a SummedAreaTableBuild.  Adds the running sums down each of the tile's columns of the table to its row sums, a row at a time (each row's sums being the whole row's of the one above, so the rows are summed in order).
+static void sumSummedAreaTableColumnsTile(void *context, int tileI)
 {
-	static const size_t kBytesPerPixel = tComponentCount;
-	
-	if (pointUVs == NULL)
-		pointUVs = kDefaultPointUVs;
-	if (destBufferAllocator == NULL)
-		destBufferAllocator = defaultDestBufferAllocator;
+	const struct SummedAreaTableBuild &build = *(const struct SummedAreaTableBuild *)context;
+	const int sumsPerRow = (build.srcWidth + 1) * build.channelCount;
 	
+	const int startI = tileI * build.tileLineCount,
+		endI = (sumsPerRow - startI > build.tileLineCount) ? startI + build.tileLineCount : sumsPerRow;
+	for (int y = 2; y <= build.srcHeight; ++y) {
+		uint32_t *rowSums = &build.sums[(size_t)y * sumsPerRow];
+		const uint32_t *aboveRowSums = rowSums - sumsPerRow;
+		for (int sumI = startI; sumI < endI; ++sumI)
+			rowSums[sumI] += aboveRowSums[sumI];
+	}
+}
+
+CGTextureMappingSummedAreaTableRef cgTextureMappingSummedAreaTableCreate(int srcWidth, int srcHeight, CFDataRef srcData, int channelCount, int threadCount) {
+	if (!(channelCount >= 1 && channelCount <= kMaxChannelCount)) {
+		assertMessage(false,
+			"The channelCount supplied (%d) is out-of-range; must be within 1 to 4.", channelCount
+		);
+		return NULL;
+	}
+	if (!(srcWidth >= 1 && srcHeight >= 1)) {
+		assertMessage(false,
+			"The src size supplied (%d×%d) must be at least 1×1.", srcWidth, srcHeight
+		);
+		return NULL;
+	}
+	if (!((int64_t)(srcWidth + 1) * channelCount <= INT_MAX)) {
+		assertMessage(false,
+			"The src width supplied (%d) is too wide for a summed-area table row.", srcWidth
+		);
+		return NULL;
+	}
 	const size_t srcByteCount = CFDataGetLength(srcData);
-	assertMessage(srcByteCount == (srcWidth * srcHeight * kBytesPerPixel),
-		"Byte count of srcData (%zu) must equal the total src bytes (%zu; srcWidth (%d) * srcHeight (%d) * componentCount (%d)).",
-		srcByteCount, (srcWidth * srcHeight * kBytesPerPixel), srcWidth, srcHeight, tComponentCount
-	);
-	
-	const UInt8 *srcBytes = CFDataGetBytePtr(srcData);
-	assertMessage(srcBytes != NULL,
-		"Bytes of srcData must come back non-NULL.", NULL
-	);
-	struct DestImageGenInfo info = {
-		srcWidth, srcHeight,
-		/* srcSize_v2: */ GLKVector2Make(srcWidth, srcHeight),
-		srcBytes,
-		/* destSizeReciprocal_v2: */ GLKVector2Make(1.0f / destWidth, 1.0f / destHeight),
-		/* points union: */ { /* aftStar: */ points[0], /* aftPort: */ points[1], /* foreStar: */ points[2], /* forePort: */ points[3] },
-		/* segmentAftDelta: */ GLKVector2Invalid, /* segmentForeDelta: */ GLKVector2Invalid,
-		/* segmentAftLengthSqr: */ NAN, /* segmentForeLengthSqr: */ NAN,
-		/* pointUVs union: */ { pointUVs[0], pointUVs[1], pointUVs[2], pointUVs[3] },
-	};
-	info.segmentAftDelta = GLKVector2Subtract(info.pointAftPort, info.pointAftStar);
-	info.segmentForeDelta = GLKVector2Subtract(info.pointForePort, info.pointForeStar);
-	// hack to avoid `… / 0 = NaN` issues:
-	info.segmentAftLengthSqr = GLKVector2AllEqualToScalar(info.segmentAftDelta, 0.0f) ? FLT_MIN : GLKVector2LengthSqr(info.segmentAftDelta);
-	info.segmentForeLengthSqr = GLKVector2AllEqualToScalar(info.segmentForeDelta, 0.0f) ? FLT_MIN : GLKVector2LengthSqr(info.segmentForeDelta);
-	
-	unsigned int pixelCount = destWidth * destHeight;
-	
-	// kinda awesome trick to check that the destBufferAllocator actually changed the value of its `out_takeOwnership` arg
-	union { bool should; uint8_t asUint8; } takeOwnership = { .asUint8 = kInvalidBoolValue };
-	UInt8 *byteBuffer = destBufferAllocator(destBufferAllocatorInfo, pixelCount, kBytesPerPixel, &takeOwnership.should);
-	assertMessage(takeOwnership.asUint8 != kInvalidBoolValue,
-		"The DestBufferAllocator callback's out_takeOwnership arg must be set before returning.", NULL
-	); // you really do have to set the variable
-	
-	for (int pixelX = destWidth - 1; pixelX >= 0; --pixelX) {
-		for (int pixelY = destHeight - 1; pixelY >= 0; --pixelY) {
-			int pixelI = pixelY * destWidth + pixelX;
-			
-			off_t position = pixelI * kBytesPerPixel;
-			UInt8 *pixelBytes = &byteBuffer[position];
-			
-			genDestImagePixelBytes<tUVMode, tSTMode, tComponentCount>(info, pixelX, pixelY, pixelBytes);
-		}
+	if (srcByteCount != (size_t)srcWidth * srcHeight * channelCount) {
+		assertMessage(false,
+			"Byte count of srcData (%zu) must equal the total src bytes (%zu; srcWidth (%d) * srcHeight (%d) * channelCount (%d)).",
+			srcByteCount, ((size_t)srcWidth * srcHeight * channelCount), srcWidth, srcHeight, channelCount
+		);
+		return NULL;
 	}
 	
-	const size_t byteCount = pixelCount * kBytesPerPixel;
-	CFDataRef data = CFDataCreateWithBytesNoCopy(NULL, byteBuffer, byteCount, takeOwnership.should ? kCFAllocatorMalloc : kCFAllocatorNull);
-	return data;
+	struct CGTextureMappingSummedAreaTable *summedAreaTable = (struct CGTextureMappingSummedAreaTable *)calloc(1, sizeof(struct CGTextureMappingSummedAreaTable));
+	summedAreaTable->channelCount = channelCount;
+	summedAreaTable->srcWidth = srcWidth;
+	summedAreaTable->srcHeight = srcHeight;
+	const size_t sumsPerRow = (size_t)(srcWidth + 1) * channelCount;
+	summedAreaTable->sums = (uint32_t *)malloc(sumsPerRow * (srcHeight + 1) * sizeof(uint32_t));
+	memset(summedAreaTable->sums, 0, sumsPerRow * sizeof(uint32_t));
+	
+	// (the sums along the rows first, which the sums down the columns then add up; each pass run across the threads in turn)
+	struct SummedAreaTableBuild build = { CFDataGetBytePtr(srcData), srcWidth, srcHeight, channelCount, summedAreaTable->sums };
+	build.tileLineCount = (kTilePixelCount > srcWidth) ? kTilePixelCount / srcWidth : 1;
+	tileWorkerPoolRun((srcHeight + build.tileLineCount - 1) / build.tileLineCount, threadCount, kSumSummedAreaTableRowsTileFunctions[channelCount - 1], &build);
+	build.tileLineCount = kSummedAreaTableTileColumnCount;
+	tileWorkerPoolRun((int)((sumsPerRow + build.tileLineCount - 1) / build.tileLineCount), threadCount, sumSummedAreaTableColumnsTile, &build);
+	
+	return summedAreaTable;
+}
+void cgTextureMappingSummedAreaTableRelease(CGTextureMappingSummedAreaTableRef summedAreaTable) {
+	if (summedAreaTable == NULL)
+		return;
+	
+	free(summedAreaTable->sums);
+	free(summedAreaTable);
 }
 
-template<OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode>
-inline CFDataRef cgTextureMappingBlit(int srcWidth, int srcHeight, CFDataRef srcData, int destWidth, int destHeight, const GLKVector2 points[4], const GLKVector2 pointUVs[4], int channelCount, DestBufferAllocator destBufferAllocator, void *destBufferAllocatorInfo) {
-	switch (channelCount) {
-		case 1: return cgTextureMappingBlit<tUVMode, tSTMode, 1>(srcWidth, srcHeight, srcData, destWidth, destHeight, points, pointUVs, destBufferAllocator, destBufferAllocatorInfo);
-		case 2: return cgTextureMappingBlit<tUVMode, tSTMode, 2>(srcWidth, srcHeight, srcData, destWidth, destHeight, points, pointUVs, destBufferAllocator, destBufferAllocatorInfo);
-		case 3: return cgTextureMappingBlit<tUVMode, tSTMode, 3>(srcWidth, srcHeight, srcData, destWidth, destHeight, points, pointUVs, destBufferAllocator, destBufferAllocatorInfo);
-		case 4: return cgTextureMappingBlit<tUVMode, tSTMode, 4>(srcWidth, srcHeight, srcData, destWidth, destHeight, points, pointUVs, destBufferAllocator, destBufferAllocatorInfo);
-		default:
-			assertMessage(channelCount >= 1 && channelCount <= 4,
-				"The channelCount supplied (%d) is out-of-range; must be within 1 to 4.", channelCount
-			);
-			return NULL;
+
+#pragma mark Tiled Srcs
+
+/// The src rows being copied into a tiled src's tiles, for the TileWorkerPool: a row of tiles per tile of work.
+struct TiledSrcConversion {
+	const UInt8 *srcBytes;
+	size_t srcBytesPerRow;
+	const struct CGTextureMappingTiledSrc *tiledSrc;
+};
+
+/// TileWork callback; `context` is a TiledSrcConversion.  Copies the src texels of the `tileRowI`-th row of tiles into them, a tile at a time, each written in order (so just its own few cache lines at once) from its kSrcTileSize short runs of src rows; and pads out the tiles past the src's edges.
+template<int tComponentCount>
+void convertTiledSrcTileRow(void *context, int tileRowI)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	const struct TiledSrcConversion &conversion = *(const struct TiledSrcConversion *)context;
+	const struct CGTextureMappingTiledSrc &tiledSrc = *conversion.tiledSrc;
+	const int startY = tileRowI * kSrcTileSize;
+	const int tileHeight = (tiledSrc.srcHeight - startY > kSrcTileSize) ? kSrcTileSize : tiledSrc.srcHeight - startY;
+	UInt8 *tileBytes = &tiledSrc.bytes[(size_t)tileRowI * tiledSrc.tileCountX * kSrcTileTexelCount * kBytesPerPixel];
+	for (int tileX = 0; tileX < tiledSrc.tileCountX; ++tileX, tileBytes += kSrcTileTexelCount * kBytesPerPixel) {
+		const int startX = tileX * kSrcTileSize;
+		const int tileWidth = (tiledSrc.srcWidth - startX > kSrcTileSize) ? kSrcTileSize : tiledSrc.srcWidth - startX;
+		if (tileWidth < kSrcTileSize || tileHeight < kSrcTileSize)
+			memset(tileBytes, 0, kSrcTileTexelCount * kBytesPerPixel);
+		
+		const UInt8 *srcRowBytes = &conversion.srcBytes[startY * conversion.srcBytesPerRow + startX * kBytesPerPixel];
+		for (int y = 0; y < tileHeight; ++y, srcRowBytes += conversion.srcBytesPerRow) {
+			const int rowMortonBits = mortonSpreadTileBits(y) << 1;
+			for (int x = 0; x < tileWidth; ++x)
+				copyBytesToPixelFromTexel<tComponentCount>(&tileBytes[(rowMortonBits | mortonSpreadTileBits(x)) * kBytesPerPixel], &srcRowBytes[x * kBytesPerPixel]);
+		}
 	}
 }
-template<OutsideOfQuadUVMode tUVMode>
-inline CFDataRef cgTextureMappingBlit(
-	int srcWidth, int srcHeight, CFDataRef srcData,
-	int destWidth, int destHeight,
-	const GLKVector2 points[4], const GLKVector2 pointUVs[4],
-	OutsideOfTextureSTMode stMode, int channelCount,
-	DestBufferAllocator destBufferAllocator, void *destBufferAllocatorInfo
-) {
-	switch (stMode) {
-		case OutsideOfTextureSTWrap: return cgTextureMappingBlit<tUVMode, OutsideOfTextureSTWrap>(srcWidth, srcHeight, srcData, destWidth, destHeight, points, pointUVs, channelCount, destBufferAllocator, destBufferAllocatorInfo);
-		case OutsideOfTextureSTClamp: return cgTextureMappingBlit<tUVMode, OutsideOfTextureSTClamp>(srcWidth, srcHeight, srcData, destWidth, destHeight, points, pointUVs, channelCount, destBufferAllocator, destBufferAllocatorInfo);
-		default:
-			assertMessage(false,
-				"The stMode supplied (%d) is not a valid OutsideOfTextureSTMode value", stMode
-			);
-			return NULL;
+
+/// Indexed by channel count less 1.
+static TileWork * const kConvertTiledSrcTileRowFunctions[kMaxChannelCount] = {
+	convertTiledSrcTileRow<1>, convertTiledSrcTileRow<2>, convertTiledSrcTileRow<3>, convertTiledSrcTileRow<4>,
+};
+
+CGTextureMappingTiledSrcRef cgTextureMappingTiledSrcCreate(int srcWidth, int srcHeight, CFDataRef srcData, int channelCount, int threadCount) {
+	if (!(channelCount >= 1 && channelCount <= kMaxChannelCount)) {
+		assertMessage(false,
+			"The channelCount supplied (%d) is out-of-range; must be within 1 to 4.", channelCount
+		);
+		return NULL;
 	}
+	const size_t srcByteCount = CFDataGetLength(srcData);
+	if (srcByteCount != (size_t)srcWidth * srcHeight * channelCount) {
+		assertMessage(false,
+			"Byte count of srcData (%zu) must equal the total src bytes (%zu; srcWidth (%d) * srcHeight (%d) * channelCount (%d)).",
+			srcByteCount, ((size_t)srcWidth * srcHeight * channelCount), srcWidth, srcHeight, channelCount
+		);
+		return NULL;
+	}
+	
+	return cgTextureMappingTiledSrcCreateWithBytes(srcWidth, srcHeight, CFDataGetBytePtr(srcData), (size_t)srcWidth * channelCount, channelCount, threadCount);
 }
-CFDataRef cgTextureMappingBlit(int srcWidth, int srcHeight, CFDataRef srcData, int destWidth, int destHeight, const GLKVector2 points[4], const GLKVector2 pointUVs[4], OutsideOfQuadUVMode uvMode, OutsideOfTextureSTMode stMode, int channelCount, DestBufferAllocator destBufferAllocator, void *destBufferAllocatorInfo) {
-	switch (uvMode) {
-		case OutsideOfQuadUVWrap: return cgTextureMappingBlit<OutsideOfQuadUVWrap>(srcWidth, srcHeight, srcData, destWidth, destHeight, points, pointUVs, stMode, channelCount, destBufferAllocator, destBufferAllocatorInfo);
-		case OutsideOfQuadUVClamp: return cgTextureMappingBlit<OutsideOfQuadUVClamp>(srcWidth, srcHeight, srcData, destWidth, destHeight, points, pointUVs, stMode, channelCount, destBufferAllocator, destBufferAllocatorInfo);
-		case OutsideOfQuadUVSkip: return cgTextureMappingBlit<OutsideOfQuadUVSkip>(srcWidth, srcHeight, srcData, destWidth, destHeight, points, pointUVs, stMode, channelCount, destBufferAllocator, destBufferAllocatorInfo);
-		default:
-			assertMessage(false,
-				"The uvMode supplied (%d) is not a valid OutsideOfQuadUVMode value", uvMode
-			);
-			return NULL;
+CGTextureMappingTiledSrcRef cgTextureMappingTiledSrcCreateWithBytes(int srcWidth, int srcHeight, const UInt8 *srcBytes, size_t srcBytesPerRow, int channelCount, int threadCount) {
+	if (!(channelCount >= 1 && channelCount <= kMaxChannelCount)) {
+		assertMessage(false,
+			"The channelCount supplied (%d) is out-of-range; must be within 1 to 4.", channelCount
+		);
+		return NULL;
+	}
+	if (!(srcWidth >= 1 && srcHeight >= 1)) {
+		assertMessage(false,
+			"The src size supplied (%d×%d) must be at least 1×1.", srcWidth, srcHeight
+		);
+		return NULL;
 	}
+	if (!(srcBytes != NULL && srcBytesPerRow >= (size_t)srcWidth * channelCount)) {
+		assertMessage(false,
+			"The srcBytes supplied must be non-NULL, in rows of at least srcWidth (%d) * channelCount (%d) bytes (not %zu).", srcWidth, channelCount, srcBytesPerRow
+		);
+		return NULL;
+	}
+	
+	struct CGTextureMappingTiledSrc *tiledSrc = (struct CGTextureMappingTiledSrc *)calloc(1, sizeof(struct CGTextureMappingTiledSrc));
+	tiledSrc->channelCount = channelCount;
+	tiledSrc->srcWidth = srcWidth;
+	tiledSrc->srcHeight = srcHeight;
+	tiledSrc->tileCountX = (srcWidth + kSrcTileSize - 1) / kSrcTileSize;
+	tiledSrc->tileCountY = (srcHeight + kSrcTileSize - 1) / kSrcTileSize;
+	tiledSrc->bytes = (UInt8 *)malloc((size_t)tiledSrc->tileCountX * tiledSrc->tileCountY * kSrcTileTexelCount * channelCount);
+	
+	struct TiledSrcConversion conversion = { srcBytes, srcBytesPerRow, tiledSrc };
+	tileWorkerPoolRun(tiledSrc->tileCountY, threadCount, kConvertTiledSrcTileRowFunctions[channelCount - 1], &conversion);
+	
+	return tiledSrc;
+}
+void cgTextureMappingTiledSrcRelease(CGTextureMappingTiledSrcRef tiledSrc) {
+	if (tiledSrc == NULL)
+		return;
+	
+	free(tiledSrc->bytes);
+	free(tiledSrc);
+}
+
+
+#pragma mark Resampling Filter Weights
+
+/// @return: `kernel`'s weight for a texel `distance` texels from the sample point.
+static double resamplingKernelWeight(const ResamplingKernel kernel, double distance)
+{
+	distance = fabs(distance);
+	if (kernel == ResamplingKernelLanczos3) {
+		static const double kRadius = 3.0;
+		if (distance >= kRadius)
+			return 0.0;
+		if (distance == 0.0)
+			return 1.0;
+		const double piDistance = M_PI * distance;
+		return kRadius * sin(piDistance) * sin(piDistance / kRadius) / (piDistance * piDistance);
+	}
+	
+	// Mitchell & Netravali's cubics: Catmull-Rom being B = 0, C = 1/2
+	const double b = (kernel == ResamplingKernelMitchell) ? 1.0 / 3.0 : 0.0,
+		c = (kernel == ResamplingKernelMitchell) ? 1.0 / 3.0 : 0.5;
+	if (distance < 1.0)
+		return ((12.0 - 9.0 * b - 6.0 * c) * distance * distance * distance + (-18.0 + 12.0 * b + 6.0 * c) * distance * distance + (6.0 - 2.0 * b)) / 6.0;
+	if (distance < 2.0)
+		return ((-b - 6.0 * c) * distance * distance * distance + (6.0 * b + 30.0 * c) * distance * distance + (-12.0 * b - 48.0 * c) * distance + (8.0 * b + 24.0 * c)) / 6.0;
+	return 0.0;
+}
+
+struct ResamplingFilterWeightTables {
+	struct ResamplingFilterWeights kernels[kResamplingKernelCount];
+};
+
+static struct ResamplingFilterWeightTables makeResamplingFilterWeightTables()
+{
+	static const int kWeightOne = 1 << kResamplingWeightBits;
+	
+	struct ResamplingFilterWeightTables tables = {};
+	for (int kernelI = 0; kernelI < kResamplingKernelCount; ++kernelI) {
+		struct ResamplingFilterWeights &kernelWeights = tables.kernels[kernelI];
+		kernelWeights.tapCount = (kernelI == ResamplingKernelLanczos3) ? 6 : 4;
+		const int firstTapOffset = 1 - kernelWeights.tapCount / 2;
+		for (int phaseI = 0; phaseI < kResamplingPhaseCount; ++phaseI) {
+			const double phase = (double)phaseI / (kResamplingPhaseCount - 1);
+			int *weights = kernelWeights.weights[phaseI];
+			
+			// (normalized before rounding, the windowed sinc's weights not summing to exactly 1; then the rounding's error all given to the heaviest tap)
+			double exactWeights[kMaxResamplingTapCount], weightSum = 0.0;
+			for (int tapI = 0; tapI < kernelWeights.tapCount; ++tapI) {
+				exactWeights[tapI] = resamplingKernelWeight((ResamplingKernel)kernelI, (firstTapOffset + tapI) - phase);
+				weightSum += exactWeights[tapI];
+			}
+			int roundedWeightSum = 0, heaviestTapI = 0;
+			for (int tapI = 0; tapI < kernelWeights.tapCount; ++tapI) {
+				weights[tapI] = (int)lround(exactWeights[tapI] / weightSum * kWeightOne);
+				roundedWeightSum += weights[tapI];
+				if (weights[tapI] > weights[heaviestTapI])
+					heaviestTapI = tapI;
+			}
+			weights[heaviestTapI] += kWeightOne - roundedWeightSum;
+		}
+	}
+	return tables;
+}
+
+const struct ResamplingFilterWeights & resamplingFilterWeights(ResamplingKernel kernel)
+{
+	static const struct ResamplingFilterWeightTables tables = makeResamplingFilterWeightTables();
+	return tables.kernels[kernel];
 }
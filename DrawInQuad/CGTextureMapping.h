@@ -16,12 +16,141 @@ typedef enum OutsideOfTextureSTMode {
 	OutsideOfTextureSTClamp,
 } OutsideOfTextureSTMode;
 
+/// How dest surface positions are mapped back into the quad.
+typedef enum QuadMappingMode {
+	/// Nearest-point-on-the-aft-&-fore-segments approximation; distorts as the quad becomes less of a parallelogram.
+	QuadMappingBilinear,
+	/// Homography (3×3 projective transform) from the quad's points; the correct perspective result.
+	QuadMappingProjective,
+	/// Two triangles (aft-star & fore-port, split along the aft-port-to-fore-star diagonal) with barycentric interpolation, as a GPU would draw the quad.
+	QuadMappingBarycentric,
+	/// Exact inverse of the bilinear patch through the quad's points (solving its quadratic per pixel), as GPU bilinear patches map it.
+	QuadMappingInverseBilinear,
+} QuadMappingMode;
+
+/// How the src is sampled at each dest pixel's texel coord.
+typedef enum TextureFilterMode {
+	/// The texel the coord is in, as-is.
+	TextureFilterNearest,
+	/// The 2×2 texels whose centers surround the coord, weighted by its distance from each (in 1/256ths of a texel); the ones past the src's edges are wrapped or clamped per the OutsideOfTextureSTMode, as the coord is.  Each pixel's coord is taken at its center (rather than its top-left corner, as for nearest), so a 1:1 mapping still reproduces the src exactly.
+	TextureFilterBilinear,
+	/// Bilinear samples of the two levels of a CGTextureMappingMipChain nearest each pixel's level of detail (log2 of how many src texels a dest pixel spans, along whichever dest axis spans more), blended by where it falls between them (in 1/256ths); so minified srcs are averaged rather than aliased, and read from levels small enough to stay in cache.  The level of detail is estimated from the mapping's UV derivatives every 8 pixels along each axis, and interpolated between those.  Magnified pixels just take the bilinear sample of the src.
+	TextureFilterTrilinear,
+	/// Elliptical weighted average (Heckbert's EWA): the texels of a CGTextureMappingMipChain level within the ellipse each pixel's footprint maps to (from the mapping's Jacobian, estimated every 8 pixels along each axis as trilinear's level of detail is), weighted by a Gaussian of their distance from its center.  The level is the finest one where the ellipse's bounding box takes no more than `maxFilterTapCount` texels, so anisotropic footprints— a strongly perspective quad's, foreshortened along its receding axis— stay sharp across it rather than taking trilinear's blur along both axes.  Magnified pixels (spanning no more than a texel along either dest axis) just take the bilinear sample of the src, as trilinear's do.
+	TextureFilterEWA,
+	/// Separable bicubic: the 4×4 texels around each pixel's coord (its center, as for bilinear), weighted along each axis by a cubic of their distance from it— Catmull-Rom's or Mitchell's, per CGTextureMappingOptions' `bicubicKernel`.  The weights are looked up by the coord's phase (in 1/256ths of a texel, as bilinear's) rather than evaluated per tap, and the texels past the src's edges are wrapped or clamped per the OutsideOfTextureSTMode, each on its own.  For high-quality output, magnified or mildly minified: sharper than bilinear, at several times its cost per pixel; strongly minified srcs still alias, as they do with bilinear.
+	TextureFilterBicubic,
+	/// Separable Lanczos-3 (a sinc windowed by a wider sinc): the 6×6 texels around each pixel's coord, weighted as for bicubic.  Sharper still than Catmull-Rom, with a little more ringing at hard edges, at 1.5 to 2 times bicubic's cost per pixel.
+	TextureFilterLanczos3,
+	/// Box filter over each pixel's footprint: the average of the src texels within the rectangle bounding it (from the mapping's Jacobian, estimated every 8 pixels along each axis as EWA's is), rounded to whole texels and read from a CGTextureMappingSummedAreaTable with 4 lookups per channel however many texels it spans.  So strongly minified srcs are averaged over exactly the texels each pixel covers, with no mip levels to pick between— and their blur or aliasing where the level of detail falls between them— though axis-aligned boxes blur diagonal footprints more than EWA's ellipses.  Magnified pixels (a footprint under 1.5 texels each way) just take the bilinear sample of the src.
+	TextureFilterSummedArea,
+} TextureFilterMode;
+
+/// The cubic TextureFilterBicubic weighs texels with.
+typedef enum BicubicKernel {
+	/// Interpolates (a texel center is sampled as just that texel), and keeps edges sharp, with a slight overshoot at them.
+	BicubicKernelCatmullRom,
+	/// Mitchell & Netravali's B = C = 1/3: a little softer than Catmull-Rom, with less overshoot; it doesn't interpolate.
+	BicubicKernelMitchell,
+} BicubicKernel;
+
+/// The orthogonal rotations & mirror flips of an image (in y-down image space).
+typedef enum OrthogonalTransform {
+	OrthogonalTransformIdentity,
+	/// Clockwise.
+	OrthogonalTransformRotate90,
+	OrthogonalTransformRotate180,
+	/// Clockwise (90° counter-clockwise).
+	OrthogonalTransformRotate270,
+	/// Mirrors left-to-right.
+	OrthogonalTransformFlipHorizontal,
+	/// Mirrors top-to-bottom.
+	OrthogonalTransformFlipVertical,
+	/// Mirrors across the top-left-to-bottom-right diagonal.
+	OrthogonalTransformTranspose,
+	/// Mirrors across the top-right-to-bottom-left diagonal.
+	OrthogonalTransformTransverse,
+} OrthogonalTransform;
+
+/// The order the blit works through the dest's pixels in.  Either way they're split into tiles across threads, and come out the same.
+typedef enum DestTraversal {
+	/// Blocks where a dest row would read across several times more src cache lines than fit in L1 (so the next row, reading many of the same ones, would miss on them): a quad rotated well away from the src's axes (45° to 90°, say), wide enough for it to matter.  Rows otherwise.
+	DestTraversalAutomatic,
+	/// Row by row, top to bottom.
+	DestTraversalRows,
+	/// 128×32-pixel blocks, visited along a Hilbert curve (each block next to the one before, so the src each reads overlaps the last's), and each worked through row by row; so a rotated quad's src reads stay within a block's worth of src rows, however it runs across them.  Up to twice as fast as rows for a 1:1 quad at 45° to 90°; slower where the rows' src reads already stay in cache (magnified, or near axis-aligned), for their shorter runs.  Separable blits (axis-aligned nearest-texel copies, which block their own reads) always go by rows, as do dests so much longer than wide that the curve mostly misses them.
+	DestTraversalHilbertBlocks,
+} DestTraversal;
+
+/// The instruction sets the blit has kernels for.  The best one the CPU supports is picked on first use, or the one named by the `CGTEXTUREMAPPING_ISA` environment variable (`scalar`, `sse4.1`, `avx2`, or `avx512`; lowered to the best the CPU supports if need be), for testing one kernel against another.
+typedef enum CGTextureMappingISA {
+	CGTextureMappingISAScalar,
+	CGTextureMappingISASSE41,
+	CGTextureMappingISAAVX2,
+	CGTextureMappingISAAVX512,
+} CGTextureMappingISA;
+
+
+/// A src image's mip chain, for TextureFilterTrilinear & TextureFilterEWA blits; see cgTextureMappingMipChainCreate().
+typedef struct CGTextureMappingMipChain *CGTextureMappingMipChainRef;
+
+/// A src image's summed-area table, for TextureFilterSummedArea blits; see cgTextureMappingSummedAreaTableCreate().
+typedef struct CGTextureMappingSummedAreaTable *CGTextureMappingSummedAreaTableRef;
+
+/// A copy of a src image in tiles, for TextureFilterNearest & TextureFilterBilinear blits to read in place of its rows; see cgTextureMappingTiledSrcCreate().
+typedef struct CGTextureMappingTiledSrc *CGTextureMappingTiledSrcRef;
+
 
 /// In order to use the `out_takeOwnership` mechanism, the returned data must've been allocated with malloc(), realloc(), or calloc().
 /// @arg out_takeOwnership: Required out-param specifying if createDestImageData() should take ownership of the byte buffer (if it should ensure it's `free()`ed via CFData's deallocator).
 /// @return: A buffer in which to store the pixel data, of at least `(pixelCount * bytesPerPixel)` in size.
 typedef UInt8 * DestBufferAllocator(void *info, int pixelCount, size_t bytesPerPixel, bool *out_takeOwnership);
 
+/// Settings for cgTextureMappingBlitWithOptions().  Start from a copy of kDefaultCGTextureMappingOptions & change just the fields needed, so fields added later keep their defaults.
+typedef struct CGTextureMappingOptions {
+	QuadMappingMode mappingMode;
+	/// How many threads to split the blit across, the calling thread included: 1 to blit on the calling thread only, or 0 for one per CPU core.  (The output is the same either way.)
+	int threadCount;
+	/// 0 to find texels with float coords, or how many fraction bits (8 to 16) to give fixed-point ones instead, which are stepped, wrapped & clamped with integer ops.  Fewer are used where the src is too big (or the UVs span too many wraps) for the coords to fit in 30 bits: 16.16 up to 8K texels a side (for UVs within [0, 1]), down to 19.13 at 64K; below 8 the blit falls back to float coords.
+	/// 	A pixel can only read a different texel than with float coords where its coord is within 33 / 2^fractionBits texels of a texel edge (about 1/2000 of a texel at 16.16), beyond the float coord's own rounding; and then it reads the texel across that edge.
+	int fixedPointFractionBits;
+	/// Nearest-texel sampling by default; bilinear smooths magnified srcs (at roughly twice the cost per pixel, and without the separable paths' plain copies for axis-aligned mappings); trilinear also filters minified srcs, given their `mipChain`; EWA filters them anisotropically, at several times trilinear's cost per pixel (5 to 15 times, for a strongly minified src at the default `maxFilterTapCount`); bicubic & Lanczos-3 resample with wider, sharper filters, for high-quality output; summed-area box-filters each pixel's whole footprint in constant time, given the src's `summedAreaTable`.
+	/// 	Trilinear, EWA & summed-area pick their sampling per dest tile, from the footprints they estimate: a tile where every pixel magnifies the src (the near end of a perspective quad, say) just takes bilinear's kernel, as fast as a bilinear blit there, with the same output as filtering each pixel.
+	TextureFilterMode filterMode;
+	/// The src's mip chain, which TextureFilterTrilinear & TextureFilterEWA require (and the other filter modes ignore); it must've been created from a src of the same size & channel count.
+	CGTextureMappingMipChainRef mipChain;
+	/// For TextureFilterEWA (9 to 1024; ignored otherwise): the most src texels a pixel may take, trading sharpness for speed— a pixel whose footprint would take more is sampled from a smaller mip level.  The default of 64 keeps up to 8:1 anisotropy sharp.
+	int maxFilterTapCount;
+	/// For TextureFilterBicubic (ignored otherwise): its cubic, Catmull-Rom by default.
+	BicubicKernel bicubicKernel;
+	/// The src's summed-area table, which TextureFilterSummedArea requires (and the other filter modes ignore); it must've been created from a src of the same size & channel count.
+	CGTextureMappingSummedAreaTableRef summedAreaTable;
+	/// NULL, or a tiled copy of the src for TextureFilterNearest & TextureFilterBilinear to read texels from (the other filter modes ignore it); it must've been created from a src of the same size & channel count.  Rotated & skewed mappings read a src's rows at a slant, touching a new cache line (and, for big srcs, a new page) for most texels; its tiles keep the texels around each one within a cache line or two whatever the angle, so they mostly read lines & pages the last few pixels already have.  Mappings whose dest rows read nearer along the src's rows (axis-aligned ones, or those within some 15–20° of it) still read the src's own bytes, as they read those in order anyway, faster than across the tiles.  (The output is the same either way.)
+	CGTextureMappingTiledSrcRef tiledSrc;
+	/// For OutsideOfQuadUVSkip (ignored otherwise): whether to antialias the quad's edges, rather than leaving them as a staircase of whole pixels.  Each pixel an edge crosses is drawn with its texel coord clamped into the quad, and takes how much of its square the quad covers (found analytically, to 1/255th) as its coverage: scaling its alpha, for 2- & 4-channel blits (whose last channel is alpha, not premultiplied), and written to `edgeCoverageBytes`, if given.  The pixels wholly within the quad are drawn by the same paths as without it, at no extra cost; the ones wholly outside are still skipped.
+	/// 	Coverage is of the quad's outline— the straight edges between its points— which the projective, barycentric & inverse-bilinear mappings cover exactly, and the bilinear one approximately.  Quads that aren't convex keep their staircase edges.
+	bool antialiasesEdges;
+	/// With `antialiasesEdges`: NULL, or a buffer of `destWidth * destHeight` bytes (in rows `destWidth` long) to fill with each dest pixel's coverage, 0 to 255— for 1- & 3-channel blits, with no alpha to scale, to composite the dest by.
+	UInt8 *edgeCoverageBytes;
+	/// The order to work through the dest in; automatic by default.  (The output is the same either way.)
+	DestTraversal destTraversal;
+} CGTextureMappingOptions;
+
+static const CGTextureMappingOptions kDefaultCGTextureMappingOptions = {
+	.mappingMode = QuadMappingBilinear,
+	.threadCount = 0,
+	.fixedPointFractionBits = 0,
+	.filterMode = TextureFilterNearest,
+	.mipChain = NULL,
+	.maxFilterTapCount = 64,
+	.bicubicKernel = BicubicKernelCatmullRom,
+	.summedAreaTable = NULL,
+	.tiledSrc = NULL,
+	.antialiasesEdges = false,
+	.edgeCoverageBytes = NULL,
+	.destTraversal = DestTraversalAutomatic,
+};
+
 static const GLKVector2 kDefaultPointUVs[4] = {
 	(GLKVector2){ .x = 1.0f, .y = 0.0f },
 	(GLKVector2){ .x = 0.0f, .y = 0.0f },
@@ -35,12 +164,14 @@ static const GLKVector2 kDefaultPointUVs[4] = {
 	/// @arg pointUVs: The UV coordinates for each point.  If NULL, will use kDefaultPointUVs.
 	/// @arg destBufferAllocator: A DestBufferAllocator function to use for allocation of the memory that'll be returned, or NULL to use the default allocater.
 	/// @arg destBufferAllocatorInfo: A pointer to data of any type or NULL.  When the destBufferAllocator is called, it is sent this pointer.
-	template<OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, int tComponentCount>
+	/// @arg threadCount: As CGTextureMappingOptions' `threadCount`.
+	template<OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, int tComponentCount, QuadMappingMode tMappingMode=QuadMappingBilinear>
 	CFDataRef cgTextureMappingBlit(
 		int srcWidth, int srcHeight, CFDataRef srcData,
 		int destWidth, int destHeight,
 		const GLKVector2 points[4], const GLKVector2 pointUVs[4],
-		DestBufferAllocator destBufferAllocator=NULL, void *destBufferAllocatorInfo=NULL
+		DestBufferAllocator destBufferAllocator=NULL, void *destBufferAllocatorInfo=NULL,
+		int threadCount=1
 	);
 #endif
 
@@ -57,6 +188,80 @@ CFDataRef cgTextureMappingBlit(
 	DestBufferAllocator destBufferAllocator, void *destBufferAllocatorInfo
 );
 
+/// Same as cgTextureMappingBlit() (which always uses QuadMappingBilinear), but with a selectable QuadMappingMode.  Both blit on the calling thread only.
+CFDataRef cgTextureMappingBlitWithMapping(
+	int srcWidth, int srcHeight, CFDataRef srcData,
+	int destWidth, int destHeight,
+	const GLKVector2 points[4], const GLKVector2 pointUVs[4],
+	QuadMappingMode mappingMode, OutsideOfQuadUVMode uvMode, OutsideOfTextureSTMode stMode, int channelCount,
+	DestBufferAllocator destBufferAllocator, void *destBufferAllocatorInfo
+);
+
+/// Same as cgTextureMappingBlit(), but with the mapping & other settings given by a CGTextureMappingOptions.
+/// 	The dest image is split into cache-line-aligned tiles, worked through by a persistent pool of threads (started on first use) that steal tiles from each other as they run out.
+/// @arg options: The settings to use, or NULL for kDefaultCGTextureMappingOptions (which uses every CPU core).
+CFDataRef cgTextureMappingBlitWithOptions(
+	int srcWidth, int srcHeight, CFDataRef srcData,
+	int destWidth, int destHeight,
+	const GLKVector2 points[4], const GLKVector2 pointUVs[4],
+	OutsideOfQuadUVMode uvMode, OutsideOfTextureSTMode stMode, int channelCount,
+	const CGTextureMappingOptions *options,
+	DestBufferAllocator destBufferAllocator, void *destBufferAllocatorInfo
+);
+
+/// Builds the mip chain of a src image: the src itself (retained, not copied), then successive halvings of it (rounded down, to no less than 1 texel a side) down to 1×1, each box-filtered from the one before (averaging 2×2 texels, or 2×1 once a side is down to 1; an odd side's last row or column is left out).  Reusable across any number of blits of the src, from any number of threads at once.
+/// 	Each level is split into rows of tiles across the same TileWorkerPool the blits use.
+/// @arg threadCount: As CGTextureMappingOptions' `threadCount`.
+/// @return: The mip chain, to be released with cgTextureMappingMipChainRelease(); or NULL if the args are invalid.
+CGTextureMappingMipChainRef cgTextureMappingMipChainCreate(
+	int srcWidth, int srcHeight, CFDataRef srcData, int channelCount,
+	int threadCount
+);
+
+/// Frees a mip chain (releasing its src).
+void cgTextureMappingMipChainRelease(CGTextureMappingMipChainRef mipChain);
+
+/// Builds the summed-area table (integral image) of a src image: for each texel corner, the per-channel sums of the texels above & left of it, as 32-bit ints— 4 bytes per channel per texel, so 4 times the src's size.  The sums wrap past 2^32, which a box's sum (a difference of 4 of them) cancels out, so it's exact for boxes of just under 2^24 texels (a 4096×4096 src's worth) or fewer; bigger footprints are sampled with the biggest box that fits, of the same proportions.  Reusable across any number of blits of the src, from any number of threads at once; the src itself isn't kept.
+/// 	Built in two passes across the same TileWorkerPool the blits use: each row's running sums, in tiles of rows, then the sums down each column, in tiles of columns.
+/// @arg threadCount: As CGTextureMappingOptions' `threadCount`.
+/// @return: The summed-area table, to be released with cgTextureMappingSummedAreaTableRelease(); or NULL if the args are invalid.
+CGTextureMappingSummedAreaTableRef cgTextureMappingSummedAreaTableCreate(
+	int srcWidth, int srcHeight, CFDataRef srcData, int channelCount,
+	int threadCount
+);
+
+/// Frees a summed-area table.
+void cgTextureMappingSummedAreaTableRelease(CGTextureMappingSummedAreaTableRef summedAreaTable);
+
+/// Copies a src image into tiles of 8×8 texels, in rows of tiles, with each tile's texels in Morton (Z-) order— so every 2×2, 4×4 & 8×8 block of texels aligned to them is contiguous, 4×4 4-channel texels to a cache line.  Its sides are padded out to whole tiles, with 0s.  Reusable across any number of blits of the src, from any number of threads at once; the src itself isn't kept.
+/// 	Copied a row of tiles at a time across the same TileWorkerPool the blits use.
+/// @arg threadCount: As CGTextureMappingOptions' `threadCount`.
+/// @return: The tiled src, to be released with cgTextureMappingTiledSrcRelease(); or NULL if the args are invalid.
+CGTextureMappingTiledSrcRef cgTextureMappingTiledSrcCreate(
+	int srcWidth, int srcHeight, CFDataRef srcData, int channelCount,
+	int threadCount
+);
+
+/// Same as cgTextureMappingTiledSrcCreate(), but from a raw buffer of src rows `srcBytesPerRow` apart (at least `srcWidth * channelCount`; any bytes past a row's texels are skipped), such as a bitmap context's.
+CGTextureMappingTiledSrcRef cgTextureMappingTiledSrcCreateWithBytes(
+	int srcWidth, int srcHeight, const UInt8 *srcBytes, size_t srcBytesPerRow, int channelCount,
+	int threadCount
+);
+
+/// Frees a tiled src.
+void cgTextureMappingTiledSrcRelease(CGTextureMappingTiledSrcRef tiledSrc);
+
+/// @return: The instruction set the blit kernels were picked for (picking them, if no blit has yet).
+CGTextureMappingISA cgTextureMappingActiveISA(void);
+
+/// Rotates or flips an image in place, without a second full-size buffer.  (cgTextureMappingBlit() detects these same transforms from its points & UVs, but always writes to a separate dest buffer.)
+/// 	The transforms that swap the axes (90°, 270°, transpose & transverse) leave the image `height` wide & `width` tall; those are done with cache-blocked swaps for square images, or by following the permutation's cycles (with a 1-bit-per-pixel visited set) otherwise.
+/// @arg bytes: `width * height * channelCount` bytes, rows tightly packed.
+void cgTextureMappingOrthogonalTransformInPlace(
+	int width, int height, UInt8 *bytes,
+	OrthogonalTransform transform, int channelCount
+);
+
 #ifdef __cplusplus
 	} // extern "C"
 #endif
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "CGTextureMapping.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <limits.h>
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <immintrin.h>
+#endif
+
+#include "GLKMathExtensions.h"
+#include "MathExtensions.h"
+#include "TileWorkerPool.h"
+
+
+
+#pragma mark Constants
+
+static const int kQuadMappingModeCount = QuadMappingInverseBilinear + 1;
+static const int kOutsideOfQuadUVModeCount = OutsideOfQuadUVSkip + 1;
+static const int kOutsideOfTextureSTModeCount = OutsideOfTextureSTClamp + 1;
+static const int kTextureFilterModeCount = TextureFilterSummedArea + 1;
+static const int kDestTraversalCount = DestTraversalHilbertBlocks + 1;
+static const int kMaxChannelCount = 4;
+/// The range of CGTextureMappingOptions' `fixedPointFractionBits` (besides 0, for float coords).
+static const int kMinFixedPointFractionBits = 8;
+static const int kMaxFixedPointFractionBits = 16;
+/// Enough mip levels for a src up to 2^31 texels a side.
+static const int kMaxMipLevelCount = 32;
+/// The range of CGTextureMappingOptions' `maxFilterTapCount`: from the 3×3 texels an EWA footprint takes at the least.
+static const int kMinFilterTapCount = 9;
+static const int kMaxFilterTapCount = 1024;
+static const int kBicubicKernelCount = BicubicKernelMitchell + 1;
+/// The resampling filters' weight tables (see ResamplingFilterWeights): a row per phase, in 1/256ths of a texel (as the kernels find bilinear weights) plus a last for a whole texel; and weights in 1/2^14ths, few enough bits that 8-bit channels times them, summed over a filter's taps (with their negative lobes' overshoot), fit an int.
+static const int kResamplingPhaseCount = 256 + 1;
+static const int kResamplingWeightBits = 14;
+static const int kMaxResamplingTapCount = 6;
+/// The most texels a summed-area box may take: few enough that their sum of 8-bit channels (plus half the count, for rounding) fits 32 bits, which the table's sums wrap modulo.
+static const int kMaxSummedAreaTexelCount = (1 << 24) - 1;
+/// The side of a CGTextureMappingTiledSrc's square tiles, as a power of two: 8×8 texels, so a 4-channel tile is 4 cache lines, each a 4×4 quadrant of it.
+static const int kSrcTileSizeBits = 3;
+static const int kSrcTileSize = 1 << kSrcTileSizeBits;
+static const int kSrcTileTexelCount = kSrcTileSize * kSrcTileSize;
+
+
+#pragma mark Types
+
+/// How the blit wraps integer texel coords by the src size (for OutsideOfTextureSTWrap): with a mask, when both of the src's sides are powers of two, or otherwise with a multiply by a precomputed magic-number reciprocal.  Picked per blit from the src size, as the kernel is.
+typedef enum TexelWrapDivisor {
+	TexelWrapDivisorMagicNumber,
+	TexelWrapDivisorPowerOfTwo,
+} TexelWrapDivisor;
+static const int kTexelWrapDivisorCount = TexelWrapDivisorPowerOfTwo + 1;
+
+/// How the src texels the blit reads are laid out: in rows (the src's own bytes), or in the tiles of a CGTextureMappingTiledSrc (see tiledTexelIndexX()).  Picked per blit from whether it's given one, as the kernel is.
+typedef enum TexelLayout {
+	TexelLayoutLinear,
+	TexelLayoutTiled,
+} TexelLayout;
+static const int kTexelLayoutCount = TexelLayoutTiled + 1;
+
+/// The separable filters TextureFilterBicubic & TextureFilterLanczos3 resample with; the first being BicubicKernel's.
+typedef enum ResamplingKernel {
+	ResamplingKernelCatmullRom,
+	ResamplingKernelMitchell,
+	ResamplingKernelLanczos3,
+} ResamplingKernel;
+static const int kResamplingKernelCount = ResamplingKernelLanczos3 + 1;
+
+/// A resampling filter's weights, quantized by phase: how far the sample point is past the texel center at or before it, in 1/(kResamplingPhaseCount - 1)-ths of a texel.  Each phase's row has a weight per tap (the first tap being `tapCount / 2 - 1` texels before that texel), in 1/2^kResamplingWeightBits-ths, rounded so the row sums to exactly 1 (so flat areas come out unchanged).
+struct ResamplingFilterWeights {
+	int tapCount;
+	int weights[kResamplingPhaseCount][kMaxResamplingTapCount];
+};
+
+/// Behind a CGTextureMappingMipChainRef.
+struct CGTextureMappingMipChain {
+	int channelCount;
+	int levelCount;
+	int levelWidths[kMaxMipLevelCount], levelHeights[kMaxMipLevelCount];
+	/// Level 0's are the src's own bytes (its CFData retained as `srcData`); the rest are within `reducedLevelBytes`, one malloc()ed buffer for them all.
+	const UInt8 *levelBytes[kMaxMipLevelCount];
+	CFDataRef srcData;
+	UInt8 *reducedLevelBytes;
+};
+
+/// Behind a CGTextureMappingSummedAreaTable.
+struct CGTextureMappingSummedAreaTable {
+	int channelCount;
+	int srcWidth, srcHeight;
+	/// `(srcWidth + 1) * (srcHeight + 1)` sums of `channelCount` channels each, in rows `srcWidth + 1` long: the one at (x, y) being of the src texels within [0, x) × [0, y) (so the first row & column are all 0s), modulo 2^32.
+	uint32_t *sums;
+};
+
+/// Behind a CGTextureMappingTiledSrcRef.
+struct CGTextureMappingTiledSrc {
+	int channelCount;
+	int srcWidth, srcHeight;
+	/// The src's size in tiles, rounded up; the tiles past its right & bottom edges are padded out with 0s.
+	int tileCountX, tileCountY;
+	/// `tileCountX * tileCountY` tiles of kSrcTileTexelCount texels each, in rows of tiles; each tile's texels in Morton (Z-) order.
+	UInt8 *bytes;
+};
+
+/// @return: `bits` (3 of them, from within a tile) spread out to every other bit: bit `i` moved to bit `2 * i`, so x's & y's (shifted up 1) interleave into a Morton index.
+static inline int mortonSpreadTileBits(const int bits)
+{
+	return (bits & 1) | ((bits & 2) << 1) | ((bits & 4) << 2);
+}
+
+/// @return: The part of a texel's index in a CGTextureMappingTiledSrc that comes from its x: its tile's offset along the row of tiles, plus its x's bits within the tile (in the Morton index's even bits).  The whole index is that plus tiledTexelIndexY()'s.
+static inline size_t tiledTexelIndexX(const int x)
+{
+	return ((size_t)(x >> kSrcTileSizeBits) * kSrcTileTexelCount) + mortonSpreadTileBits(x & (kSrcTileSize - 1));
+}
+/// @return: As tiledTexelIndexX(), the part from a texel's y: its row of tiles' offset (`tileRowTexelCount` being `tileCountX * kSrcTileTexelCount`), plus its y's bits within the tile (in the odd bits).
+static inline size_t tiledTexelIndexY(const int y, const size_t tileRowTexelCount)
+{
+	return ((size_t)(y >> kSrcTileSizeBits) * tileRowTexelCount) + (mortonSpreadTileBits(y & (kSrcTileSize - 1)) << 1);
+}
+
+/// @return: Whether `filterMode` reads a CGTextureMappingTiledSrc, when the blit's given one, rather than the src's rows: just the ones that read single texels & 2×2s of them directly (the rest reading whole rows of taps, or the mip chain or summed-area table, instead).
+static constexpr bool filterModeReadsTiledSrc(const TextureFilterMode filterMode)
+{
+	return (filterMode == TextureFilterNearest || filterMode == TextureFilterBilinear);
+}
+
+/// @return: Whether `filterMode` samples the CGTextureMappingMipChain (which it then requires) rather than just the src.
+static inline bool filterModeSamplesMipChain(const TextureFilterMode filterMode)
+{
+	return (filterMode == TextureFilterTrilinear || filterMode == TextureFilterEWA);
+}
+
+/// @return: Whether `filterMode` sizes each pixel's filter by its footprint in the src (and so needs the footprint grid, and takes the scanline path even for affine mappings).
+static inline bool filterModeTracksFootprint(const TextureFilterMode filterMode)
+{
+	return (filterModeSamplesMipChain(filterMode) || filterMode == TextureFilterSummedArea);
+}
+
+/// @return: Whether `filterMode` is one of the separable resampling filters (see ResamplingKernel).
+static inline bool filterModeResamples(const TextureFilterMode filterMode)
+{
+	return (filterMode == TextureFilterBicubic || filterMode == TextureFilterLanczos3);
+}
+
+
+#pragma mark Macros
+
+#define assertMessage(test, failureMessage, ...)	\
+	({	\
+		if (!(test)) {	\
+			printf("Assert! \t" failureMessage "\n", __VA_ARGS__);	\
+			assert(test);	\
+		}	\
+	})
+
+
+#pragma mark Kernel Registry
+
+/// A whole blit for one combination of modes & channel count, compiled for one ISA (a cgTextureMappingBlit<>() instantiation from CGTextureMappingKernels.inl).
+typedef CFDataRef BlitKernel(
+	int srcWidth, int srcHeight, CFDataRef srcData,
+	int destWidth, int destHeight,
+	const GLKVector2 points[4], const GLKVector2 pointUVs[4],
+	DestBufferAllocator destBufferAllocator, void *destBufferAllocatorInfo,
+	const CGTextureMappingOptions &options
+);
+
+/// Every BlitKernel for one ISA, looked up directly rather than through a `switch` per mode.
+struct BlitKernelTable {
+	CGTextureMappingISA isa;
+	/// Indexed by QuadMappingMode, OutsideOfQuadUVMode, OutsideOfTextureSTMode, TextureFilterMode, TexelWrapDivisor, TexelLayout, then channel count less 1.
+	BlitKernel *kernels[kQuadMappingModeCount][kOutsideOfQuadUVModeCount][kOutsideOfTextureSTModeCount][kTextureFilterModeCount][kTexelWrapDivisorCount][kTexelLayoutCount][kMaxChannelCount];
+};
+
+/// Fill `table` with each ISA's kernels; each is defined by the file compiled for that ISA.
+/// @return: Whether this build has kernels for the ISA (`false` for the x86 ones when building for ARM).
+bool registerScalarBlitKernels(struct BlitKernelTable &table);
+bool registerSSE41BlitKernels(struct BlitKernelTable &table);
+bool registerAVX2BlitKernels(struct BlitKernelTable &table);
+bool registerAVX512BlitKernels(struct BlitKernelTable &table);
+
+
+#pragma mark Resampling Filter Weights
+
+/// The weight tables for a filter, computed (once, on first use) by CGTextureMapping.cpp— the same tables for every ISA's kernels.
+const struct ResamplingFilterWeights & resamplingFilterWeights(ResamplingKernel kernel);
@@ -0,0 +1,3617 @@
+// The blit itself, compiled once per ISA: each CGTextureMappingKernels*.cpp (and CGTextureMapping.cpp, for the scalar kernels) includes this into its own namespace, having included CGTextureMappingKernels.h & set its ISA's target & `BLIT_KERNELS_*` macro first.
+// 	Everything here must stay within that namespace (so internal to the ISA's file), so the linker can't swap in another ISA's copy of an inline function or template instantiation.
+
+
+
+#pragma mark Constants
+
+static const uint8_t kInvalidBoolValue = 0xff;
+
+/// How far (in dest pixels for `points`, src texels for `pointUVs`) the fore-port point may be from completing a parallelogram for the mapping to still be treated as affine.
+static const float kAffineParallelogramTolerance = 1.0f / 64.0f;
+
+/// How many pixels a scanline evaluator may step incrementally before recomputing its state in full, bounding the float error accumulated by the repeated adds.
+static const int kScanlineResyncInterval = 64;
+
+/// How far (in dest pixels) the per-row coverage spans are padded beyond the region a mapping mode can cover, so the mapping's own rounding can never land a covered pixel outside them.
+static const float kCoverageSpanPaddingPixels = 1.0f;
+
+/// Roughly how many dest pixels go in each tile the blit is split into for the TileWorkerPool: enough to amortize taking one, few enough for hundreds per image (for the work stealing to balance), and small enough for a tile's dest bytes to stay in L2.
+static const int kTilePixelCount = 16 * 1024;
+
+/// Size (in pixels) of the blocks DestTraversalHilbertBlocks works through: wide enough for each row span's setup to be amortized, and for the hardware prefetchers to pick up its src & dest streams, and a multiple of kScanlineResyncInterval (so each span starts where the scanline evaluator resyncs anyway); short enough for the src a block reads (a 128×32-texel region's worth at 1:1, however it's rotated) to stay in L1 while it's worked through.
+static const int kTraversalBlockWidth = 128;
+static const int kTraversalBlockHeight = 32;
+
+/// DestTraversalAutomatic takes blocks (and the blit reads the tiled src, given one) where a dest row reads across more than this many src cache lines (128 KB's worth: several times an L1's, for the next row to miss on most of the ones it shares with it, enough to outweigh the blocks' shorter runs, and the tiles' scattering of texels that rows nearer the src's own would read in order).
+static const int kRowTraversalMaxSrcCacheLines = 2048;
+
+/// The most times bigger than the dest's block count the Hilbert curve's power-of-two square may be, for DestTraversalHilbertBlocks to walk it; past that (a dest whose blocks run more than about 4 times further one way than the other) the curve mostly runs outside the dest, and it goes by rows instead.
+static const int kMaxHilbertSquareBlockRatio = 16;
+
+/// Tile boundaries are moved onto multiples of this many dest bytes, so threads never write to the same cache line.
+static const int kCacheLineSize = 64;
+
+/// Side length (in pixels) of the square tiles the axis-swapping kernels work through, so the src rows being read down & the dest rows being written along both stay in cache.
+static const int kCacheBlockSize = 32;
+
+/// How many bits of magnitude fixed-point texel coords may have (so what the fraction bits are limited to), leaving the rest of an int's for the adds that step & wrap them.
+static const int kFixedPointTexelCoordBits = 30;
+
+/// The fraction bits of bilinear filtering's weights (so `1 << kBilinearWeightBits` is a whole texel's weight): few enough that an 8-bit channel times a weight fits 16 bits, as the 4-channel SIMD blend needs (see simdLerpTexelWords()).
+static const int kBilinearWeightBits = 8;
+static const int kBilinearWeightOne = 1 << kBilinearWeightBits;
+
+/// How many dest pixels apart (along each axis) trilinear & EWA filtering estimate each pixel's footprint in the src, interpolating between those estimates for the pixels in between.  The mapping's UV derivatives change slowly enough that a few evaluations per 64 pixels follow them closely.
+static const int kFootprintGridSpacing = 8;
+
+/// EWA filtering's Gaussian weights, `exp(-2 * r²) - exp(-2)` scaled to 4096 at the center, by the squared distance `r²` through the footprint ellipse (in 1/kEWAWeightCount-ths; 0 at its center, 1 at its edge, and past it taking the 0 after the last)— the Gaussian taken down to 0 at the edge, so texels coming in & out of it as the ellipse moves don't pop.  Small enough that summing 8-bit channels times them over kMaxFilterTapCount taps fits an int.
+static const int kEWAWeightCount = 128;
+static const int kEWAWeights[kEWAWeightCount + 1] = {
+	4096, 4023, 3950, 3879, 3809, 3740, 3672, 3605, 3539, 3475, 3411, 3348, 3286, 3225, 3165, 3106,
+	3048, 2991, 2935, 2879, 2825, 2771, 2718, 2666, 2615, 2564, 2514, 2466, 2417, 2370, 2323, 2277,
+	2232, 2188, 2144, 2101, 2058, 2016, 1975, 1934, 1894, 1855, 1816, 1778, 1741, 1704, 1668, 1632,
+	1597, 1562, 1528, 1494, 1461, 1428, 1396, 1365, 1334, 1303, 1273, 1243, 1214, 1185, 1157, 1129,
+	1102, 1075, 1048, 1022, 996, 971, 946, 921, 897, 873, 849, 826, 804, 781, 759, 737,
+	716, 695, 674, 654, 634, 614, 595, 575, 557, 538, 520, 502, 484, 467, 449, 433,
+	416, 400, 383, 367, 352, 336, 321, 306, 292, 277, 263, 249, 235, 222, 208, 195,
+	182, 169, 157, 144, 132, 120, 108, 97, 85, 74, 63, 52, 41, 31, 20, 10,
+	0,
+};
+
+
+#pragma mark Intermediate Data
+
+/// One dest axis of a separable mapping: the quad ratio along it (`ratioPerST * st + ratioBase`), and the UV along the single src axis it reads.
+struct SeparableAxisMapping {
+	float ratioPerST, ratioBase;
+	float uv0, uvPerRatio;
+	/// 0 for src x (so the dest axis picks src columns), 1 for src y (src rows).
+	int srcAxis;
+};
+
+/// A src size (in texels, or fixed-point texels) that integer texel coords are wrapped by, for TexelWrapDivisor's ways of doing so without a divide (see wrapTexelCoord()).
+struct TexelWrapPeriod {
+	int period;
+	/// For TexelWrapDivisorMagicNumber: `coord / period` is `((uint64_t)coord * magicMultiplier) >> 32 >> magicShift` for every coord within [0, 2^31) (for periods of at least 2); see texelWrapPeriod().
+	uint32_t magicMultiplier;
+	int magicShift;
+	/// A whole number of periods that, added to any coord from within the UVs' range, makes it positive (so it can be wrapped as unsigned).
+	int bias;
+};
+
+/// `Aft`: Aft end
+/// `Fore`: Fore end
+/// `Star`: Starboard side
+/// `Port`: Port side
+struct DestImageGenInfo {
+	int srcWidth_i, srcHeight_i;
+	GLKVector2 srcSize_v2;
+	/// The src's own bytes, or for TexelLayoutTiled (where the dest's rows scatter their reads across the src's; see destRowsScatterSrcReads()) its CGTextureMappingTiledSrc's.
+	const UInt8 * srcBytes;
+	
+	int destWidth_i, destHeight_i;
+	GLKVector2 destSizeReciprocal_v2;
+	
+	union {
+		GLKVector2 points[4];
+		struct { GLKVector2 pointAftStar, pointAftPort, pointForeStar, pointForePort; };
+	};
+	
+	GLKVector2 segmentAftDelta, segmentForeDelta;
+	float segmentAftLengthSqr, segmentForeLengthSqr;
+	
+	union {
+		GLKVector2 pointUVs[4];
+		/// specified in standard clockwise OpenGL quad/quadstrip order: back-right, back-left, front-right, front-left
+		struct { GLKVector2 pointUV0, pointUV1, pointUV2, pointUV3; };
+	};
+	
+	/// Homography from surface ST to homogeneous quad ratios (`x`: star-to-port, `y`: aft-to-fore, `z`: w); only set up for QuadMappingProjective.
+	GLKMatrix3 surfaceSTToQuadRatios;
+	
+	/// Edge functions (`x * s + y * t + z`) giving barycentric coords 1 & 2 within the aft-star & fore-port triangles, and which side of the aft-port-to-fore-star diagonal a point is on; only set up for QuadMappingBarycentric.
+	GLKVector3 aftStarTriBarycentricEdges[2], forePortTriBarycentricEdges[2];
+	GLKVector3 quadDiagonalEdge;
+	
+	/// Whether the quad and its UVs are both parallelograms, making the whole mapping affine (and the rest of these set up).
+	bool isAffine;
+	/// Edge functions giving the quad ratios directly.
+	GLKVector3 affineStarToPortRatioEdge, affineAftToForeRatioEdge;
+	/// The UV change per unit of each quad ratio.
+	GLKVector2 affineUVPerStarToPortRatio, affineUVPerAftToForeRatio;
+	/// Whether the (affine) mapping is also axis-aligned— each dest axis reads along a single src axis, depending only on that dest axis— so each dest column always reads the same src column (or row, for 90° rotations & transposes), and each dest row the same src row (or column).
+	bool isSeparable;
+	/// For dest x & y; only set up when `isSeparable`.
+	struct SeparableAxisMapping separableAxisMappings[2];
+	
+	/// Pairs of half-planes (`x * pixelX + y * pixelY + z >= 0`) bounding the pixels the mapping could cover— each covered pixel is within at least one of each pair— which skipping rows are narrowed to; only set up for OutsideOfQuadUVSkip (and none means the whole row).
+	int coverageConstraintCount;
+	GLKVector3 coverageConstraintHalfPlanes[4][2];
+	/// Whether the quad's edges are antialiased (CGTextureMappingOptions' `antialiasesEdges`, for OutsideOfQuadUVSkip; and only for convex quads), and if so the half-planes inside each of its edges (`x * pixelX + y * pixelY + z >= 0`, with `(x, y)` of unit length, so they give the distance inside in pixels), from the quad's points before any filtered modes' half-pixel shift; see setUpAntialiasedEdges().
+	bool antialiasesEdges;
+	GLKVector3 antialiasedEdgeHalfPlanes[4];
+	/// CGTextureMappingOptions' `edgeCoverageBytes`; only set up when `antialiasesEdges`.
+	UInt8 *edgeCoverageBytes;
+	
+	/// Whether every src texel's index (`y * srcWidth_i + x`, or its index in the tiled src, for TexelLayoutTiled) fits in an int; not so for the biggest srcs.
+	bool srcTexelIndicesFitInt;
+	/// For TexelLayoutTiled (when `srcBytes` are the tiled src's): the texels per row of its tiles (see tiledTexelIndexY()).
+	int srcTileRowTexelCount;
+	/// The fraction bits of the fixed-point texel coords (`texelX * (1 << texelFractionBits)`), or 0 to use float coords; see setUpTexelCoords().
+	int texelFractionBits;
+	/// Whether wrapping is done on integer texel coords (with `texelWrapPeriods`), rather than on the float ST: always so for fixed-point coords, and for float ones unless they'd overflow an int or a magic-number divisor would have to divide by 1.
+	bool texelCoordsWrapAsInts;
+	/// Per axis (only set up when `texelCoordsWrapAsInts`): the src size in texels (or fixed-point texels) to wrap by.
+	struct TexelWrapPeriod texelWrapPeriods[2];
+	/// Per axis (only set up with `texelFractionBits`): the src size in fixed-point texels as a float, scaling ST to fixed-point texels.
+	GLKVector2 fixedPointTexelScale;
+	
+	/// Per mip level (only set up for the filter modes that sample a mip chain; see filterModeSamplesMipChain()): a copy of this info that samples the level in place of the src, with its own texel coord setup; level 0 being the src itself.
+	const struct DestImageGenInfo *mipLevelInfos;
+	int mipLevelCount;
+	/// Each pixel's footprint in the src at every kFootprintGridSpacing-th dest pixel along each axis, in rows `footprintGridWidth` long, with a row & column more past the dest's last pixels so each pixel is within 2×2 of them: as the level of detail (see mipLODAtSurfaceST()) in `mipLODGrid` for TextureFilterTrilinear, or the UV Jacobian (see footprintUVJacobianAtSurfaceST()) in `uvJacobianGrid` for TextureFilterEWA & TextureFilterSummedArea (the other one being NULL).  Only set up for the filter modes that track footprints (see filterModeTracksFootprint()).
+	int footprintGridWidth;
+	const float *mipLODGrid;
+	const struct UVJacobian *uvJacobianGrid;
+	/// Per footprint grid row: whether every pixel it's around magnifies the src (see footprintMagnifies()), so the dest tiles between such rows can just take the bilinear sample (see genDestTileBytes()).
+	const bool *magnifiedFootprintGridRows;
+	/// The most texels an EWA-filtered pixel may take (CGTextureMappingOptions' `maxFilterTapCount`); only set up for TextureFilterEWA.
+	int maxFilterTapCount;
+	/// The weights of the resampling filter (per CGTextureMappingOptions' `bicubicKernel`, for TextureFilterBicubic); only set up for the filter modes that resample (see filterModeResamples()).
+	const struct ResamplingFilterWeights *resamplingWeights;
+	/// CGTextureMappingOptions' `summedAreaTable`; only set up for TextureFilterSummedArea.
+	const struct CGTextureMappingSummedAreaTable *summedAreaTable;
+};
+
+
+#pragma mark Texture Mapping Functions
+
+/// @return: Whether the texture coordinate could potentially be normalized (`true`), or if it was too far out of range to be handled (`false`).
+template<OutsideOfQuadUVMode tUVMode> bool isTexelCoordNormalizable(const float &coord);
+template<> inline bool isTexelCoordNormalizable<OutsideOfQuadUVWrap>(const float &coord) { return true; }
+template<> inline bool isTexelCoordNormalizable<OutsideOfQuadUVClamp>(const float &coord) { return true; }
+template<> inline bool isTexelCoordNormalizable<OutsideOfQuadUVSkip>(const float &coord)
+{
+	return inRange0ToJustUnder1_f(coord);
+}
+
+/// @return: Whether the texture coordinate could be and was normalized (`true`), or if it was too far out of range to be handled (`false`).
+template<OutsideOfQuadUVMode tUVMode> void normalizeTexelCoord(float &coord);
+template<> inline void normalizeTexelCoord<OutsideOfQuadUVWrap>(float &coord)
+{
+	if (!inRange0ToJustUnder1_f(coord))
+		coord = modulo_f(coord, 1.0f);
+}
+template<> inline void normalizeTexelCoord<OutsideOfQuadUVClamp>(float &coord)
+{
+	if (!inRange0ToJustUnder1_f(coord))
+		coord = clamp0ToJustUnder1_f(coord);
+}
+template<> inline void normalizeTexelCoord<OutsideOfQuadUVSkip>(float &coord) { /* no-op */ }
+
+template<OutsideOfTextureSTMode tSTMode> void normalizeTexelSTCoord(float &coord);
+template<> inline void normalizeTexelSTCoord<OutsideOfTextureSTWrap>(float &coord)
+{
+	if (!inRange0ToJustUnder1_f(coord))
+		coord = modulo_f(coord, 1.0f);
+}
+template<> inline void normalizeTexelSTCoord<OutsideOfTextureSTClamp>(float &coord)
+{
+	if (!inRange0ToJustUnder1_f(coord))
+		coord = clamp0ToJustUnder1_f(coord);
+}
+
+template<OutsideOfTextureSTMode tSTMode>
+inline void normalizeTexelST(float st[2])
+{
+	normalizeTexelSTCoord<tSTMode>(st[0]);
+	normalizeTexelSTCoord<tSTMode>(st[1]);
+}
+
+/// @arg starToPortRatio, aftToForeRatio: Already normalized quad ratios.
+static inline GLKVector2 lerpPointUVs(const struct DestImageGenInfo &info, const float starToPortRatio, const float aftToForeRatio)
+{
+	GLKVector2 uvOnAft = GLKVector2Lerp(info.pointUV0, info.pointUV1, starToPortRatio);
+	GLKVector2 uvOnFore = GLKVector2Lerp(info.pointUV2, info.pointUV3, starToPortRatio);
+	return GLKVector2Lerp(uvOnAft, uvOnFore, aftToForeRatio);
+}
+
+/// Validates & normalizes a pair of quad ratios per `tUVMode` and lerps the point UVs.  Used by the mapping modes that produce both ratios directly.
+template<OutsideOfQuadUVMode tUVMode>
+inline GLKVector2 texelUVFromQuadRatios(const struct DestImageGenInfo &info, float starToPortRatio, float aftToForeRatio)
+{
+	if (!isTexelCoordNormalizable<tUVMode>(aftToForeRatio) || !isTexelCoordNormalizable<tUVMode>(starToPortRatio))
+		return GLKVector2Invalid;
+	
+	normalizeTexelCoord<tUVMode>(aftToForeRatio);
+	normalizeTexelCoord<tUVMode>(starToPortRatio);
+	
+	return lerpPointUVs(info, starToPortRatio, aftToForeRatio);
+}
+
+/// The back half of surfaceSTToTexelUV_bilinearQuad(): takes the ratios along the aft & fore segments and along the nearest-aft-to-nearest-fore segment, validates & normalizes them per `tUVMode`, and lerps the point UVs.
+template<OutsideOfQuadUVMode tUVMode>
+inline GLKVector2 texelUVFromBilinearQuadRatios(const struct DestImageGenInfo &info, const float ratioAlongAft, const float ratioAlongFore, float ratioAlongNearestAftToNearestFore)
+{
+	bool vCoordValid = isTexelCoordNormalizable<tUVMode>(ratioAlongNearestAftToNearestFore);
+	if (!vCoordValid)
+		return GLKVector2Invalid;
+	
+	normalizeTexelCoord<tUVMode>(ratioAlongNearestAftToNearestFore);
+	
+	float lerpedAftForeRatios = ratioAlongAft + (ratioAlongFore - ratioAlongAft) * ratioAlongNearestAftToNearestFore;
+	bool uCoordValid = isTexelCoordNormalizable<tUVMode>(lerpedAftForeRatios);
+	if (!uCoordValid)
+		return GLKVector2Invalid;
+	
+	normalizeTexelCoord<tUVMode>(lerpedAftForeRatios);
+	
+	return lerpPointUVs(info, lerpedAftForeRatios, ratioAlongNearestAftToNearestFore);
+}
+
+/// Based on a loose understanding of Wikipedia's article on Bilinear interpolation (https://en.wikipedia.org/wiki/Bilinear_interpolation).
+/// 	Probably not the best algoritm for this— works, but with more distortion as the points become less square.
+/// 	Seems to show better results when the left and right sides of the points quad are parallel.
+template<OutsideOfQuadUVMode tUVMode>
+GLKVector2 surfaceSTToTexelUV_bilinearQuad(const struct DestImageGenInfo &info, const GLKVector2 surfaceST)
+{
+	GLKVector2 nearestPointOnAft, nearestPointOnFore;
+	float ratioAlongAft = ratioAndNearestPointAlongSegment(
+		surfaceST,
+		info.pointAftStar, info.pointAftPort,
+		info.segmentAftDelta, info.segmentAftLengthSqr,
+		&nearestPointOnAft
+	);
+	float ratioAlongFore = ratioAndNearestPointAlongSegment(
+		surfaceST,
+		info.pointForeStar, info.pointForePort,
+		info.segmentForeDelta, info.segmentForeLengthSqr,
+		&nearestPointOnFore
+	);
+	
+	float ratioAlongNearestAftToNearestFore = ratioAlongSegment(surfaceST, nearestPointOnAft, nearestPointOnFore);
+	return texelUVFromBilinearQuadRatios<tUVMode>(info, ratioAlongAft, ratioAlongFore, ratioAlongNearestAftToNearestFore);
+}
+
+/// @return: -1 if the ratio is clamped to the segment's A end, 1 if clamped to its B end, or 0 if it's between the two (and so the nearest point moves linearly with the ratio).
+static inline int segmentEndClampSide(const float ratioAlongSegment)
+{
+	if (ratioAlongSegment <= 0.0f)
+		return -1;
+	else if (ratioAlongSegment >= 1.0f)
+		return 1;
+	else
+		return 0;
+}
+
+/// Steps a mapping along a dest row, one pixel per `nextTexelUV()` call (which returns GLKVector2Invalid for pixels that should be skipped).
+/// 	Constructed with the row's `pixelY` and the `pixelX` to start at.
+template<QuadMappingMode tMappingMode, OutsideOfQuadUVMode tUVMode> struct QuadScanlineEvaluator;
+
+/// @return: How many pixels a scanline evaluator that's just resynced at `pixelX` should step before resyncing again.  The interval resyncs always land on multiples of kScanlineResyncInterval, so an evaluator started at one steps exactly as one that walked there from the start of the row.
+static inline int pixelsUntilAlignedResync(const int pixelX)
+{
+	return kScanlineResyncInterval - 1 - pixelX % kScanlineResyncInterval;
+}
+
+/// Incremental (forward-differencing) evaluator of surfaceSTToTexelUV_bilinearQuad() along a dest row.
+/// 	The ratios along the aft & fore segments are linear in `pixelX`, and so are the nearest points on those segments whenever they're not clamped to a segment end; all of those are stepped with adds.  Which leaves one divide per pixel (for the ratio along the nearest-aft-to-nearest-fore segment), rather than three.
+/// 	The state is recomputed in full whenever a ratio crosses a segment end (where the clamping makes the nearest point non-linear), and every kScanlineResyncInterval pixels.
+template<OutsideOfQuadUVMode tUVMode>
+struct QuadScanlineEvaluator<QuadMappingBilinear, tUVMode> {
+	const struct DestImageGenInfo &info;
+	
+	int pixelX;
+	const float pixelT, pixelSPerX;
+	
+	const float ratioAlongAftPerX, ratioAlongForePerX;
+	const GLKVector2 nearestPointOnAftPerX, nearestPointOnForePerX;
+	
+	float ratioAlongAft, ratioAlongFore;
+	GLKVector2 nearestPointOnAft, nearestPointOnFore;
+	int aftClampSide, foreClampSide;
+	int pixelsUntilResync;
+	
+	QuadScanlineEvaluator(const struct DestImageGenInfo &info, const int pixelY, const int startPixelX) :
+		info(info),
+		pixelX(startPixelX),
+		pixelT(pixelY * info.destSizeReciprocal_v2.y), pixelSPerX(info.destSizeReciprocal_v2.x),
+		ratioAlongAftPerX(pixelSPerX * info.segmentAftDelta.x / info.segmentAftLengthSqr),
+		ratioAlongForePerX(pixelSPerX * info.segmentForeDelta.x / info.segmentForeLengthSqr),
+		nearestPointOnAftPerX(GLKVector2MultiplyScalar(info.segmentAftDelta, ratioAlongAftPerX)),
+		nearestPointOnForePerX(GLKVector2MultiplyScalar(info.segmentForeDelta, ratioAlongForePerX)),
+		pixelsUntilResync(0)
+	{}
+	
+	inline GLKVector2 nextTexelUV()
+	{
+		const GLKVector2 surfaceST = GLKVector2Make(pixelX * pixelSPerX, pixelT);
+		++pixelX;
+		
+		if (pixelsUntilResync > 0 && stepSegmentRatios())
+			--pixelsUntilResync;
+		else
+			resyncSegmentRatios(surfaceST);
+		
+		GLKVector2 nearestAftToNearestForeDelta = GLKVector2Subtract(nearestPointOnFore, nearestPointOnAft);
+		float ratioAlongNearestAftToNearestFore = ratioAlongSegment(
+			surfaceST,
+			nearestPointOnAft, nearestPointOnFore,
+			nearestAftToNearestForeDelta, GLKVector2LengthSqr(nearestAftToNearestForeDelta) // @warning: potentially zero, causings NaN (same as surfaceSTToTexelUV_bilinearQuad())
+		);
+		return texelUVFromBilinearQuadRatios<tUVMode>(info, ratioAlongAft, ratioAlongFore, ratioAlongNearestAftToNearestFore);
+	}
+	
+	/// @return: Whether the step stayed within the same clamping of both segments (`true`), or if the state needs to be resynced (`false`).
+	inline bool stepSegmentRatios()
+	{
+		ratioAlongAft += ratioAlongAftPerX;
+		ratioAlongFore += ratioAlongForePerX;
+		if (segmentEndClampSide(ratioAlongAft) != aftClampSide || segmentEndClampSide(ratioAlongFore) != foreClampSide)
+			return false;
+		
+		if (aftClampSide == 0)
+			nearestPointOnAft = GLKVector2Add(nearestPointOnAft, nearestPointOnAftPerX);
+		if (foreClampSide == 0)
+			nearestPointOnFore = GLKVector2Add(nearestPointOnFore, nearestPointOnForePerX);
+		return true;
+	}
+	
+	void resyncSegmentRatios(const GLKVector2 surfaceST)
+	{
+		ratioAlongAft = ratioAndNearestPointAlongSegment(
+			surfaceST,
+			info.pointAftStar, info.pointAftPort,
+			info.segmentAftDelta, info.segmentAftLengthSqr,
+			&nearestPointOnAft
+		);
+		ratioAlongFore = ratioAndNearestPointAlongSegment(
+			surfaceST,
+			info.pointForeStar, info.pointForePort,
+			info.segmentForeDelta, info.segmentForeLengthSqr,
+			&nearestPointOnFore
+		);
+		aftClampSide = segmentEndClampSide(ratioAlongAft);
+		foreClampSide = segmentEndClampSide(ratioAlongFore);
+		pixelsUntilResync = pixelsUntilAlignedResync(pixelX - 1); // (`pixelX` has already moved past `surfaceST`)
+	}
+};
+
+/// Builds the homography that maps quad ratios (the unit square; `x`: star-to-port, `y`: aft-to-fore) onto the quad's points.
+/// @source: Fundamentals of Texture Mapping and Image Warping by Paul Heckbert (1989) - Section 2.2.3 Inferring Projective Mappings - Square-to-quadrilateral
+static GLKMatrix3 quadRatiosToSurfaceSTHomography(const struct DestImageGenInfo &info)
+{
+	// square corners (0,0), (1,0), (1,1), (0,1) map to aft-star, aft-port, fore-port, fore-star
+	const GLKVector2 p0 = info.pointAftStar, p1 = info.pointAftPort, p2 = info.pointForePort, p3 = info.pointForeStar;
+	
+	GLKVector2 delta1 = GLKVector2Subtract(p1, p2),
+		delta2 = GLKVector2Subtract(p3, p2),
+		delta3 = GLKVector2Add(GLKVector2Subtract(p0, p1), GLKVector2Subtract(p2, p3));
+	
+	float g = 0.0f, h = 0.0f;
+	float denom = GLKVector2CrossProduct(delta1, delta2);
+	if (denom != 0.0f) { // otherwise degenerate; leave it affine
+		g = GLKVector2CrossProduct(delta3, delta2) / denom;
+		h = GLKVector2CrossProduct(delta1, delta3) / denom;
+	}
+	
+	// column-major
+	return GLKMatrix3Make(
+		p1.x - p0.x + g * p1.x, p1.y - p0.y + g * p1.y, g,
+		p3.x - p0.x + h * p3.x, p3.y - p0.y + h * p3.y, h,
+		p0.x, p0.y, 1.0f
+	);
+}
+
+/// @return: The inverse of quadRatiosToSurfaceSTHomography(), scaled so `w` is positive inside the quad; or all-zeros (so every pixel is invalid) if the quad is degenerate.
+static GLKMatrix3 surfaceSTToQuadRatiosHomography(const struct DestImageGenInfo &info)
+{
+	static const GLKMatrix3 kGLKMatrix3Zero = { };
+	
+	GLKMatrix3 quadRatiosToSurfaceST = quadRatiosToSurfaceSTHomography(info);
+	
+	bool isInvertible = false;
+	GLKMatrix3 surfaceSTToQuadRatios = GLKMatrix3Invert(quadRatiosToSurfaceST, &isInvertible);
+	if (!isInvertible)
+		return kGLKMatrix3Zero;
+	
+	GLKVector3 quadCenterST = GLKMatrix3MultiplyVector3(quadRatiosToSurfaceST, GLKVector3Make(0.5f, 0.5f, 1.0f));
+	if (quadCenterST.z < 0.0f) {
+		for (int elementI = 0; elementI < 9; ++elementI)
+			surfaceSTToQuadRatios.m[elementI] = -surfaceSTToQuadRatios.m[elementI];
+	}
+	
+	return surfaceSTToQuadRatios;
+}
+
+/// Evaluates the `info.surfaceSTToQuadRatios` homography along a dest row.
+/// 	The homogeneous quad ratios are linear in `pixelX`, so they're stepped with adds (resyncing every kScanlineResyncInterval pixels), leaving one reciprocal per pixel.
+template<OutsideOfQuadUVMode tUVMode>
+struct QuadScanlineEvaluator<QuadMappingProjective, tUVMode> {
+	const struct DestImageGenInfo &info;
+	
+	int pixelX;
+	const float pixelT, pixelSPerX;
+	
+	const GLKVector3 quadRatiosHomogeneousPerX;
+	GLKVector3 quadRatiosHomogeneous;
+	int pixelsUntilResync;
+	
+	QuadScanlineEvaluator(const struct DestImageGenInfo &info, const int pixelY, const int startPixelX) :
+		info(info),
+		pixelX(startPixelX),
+		pixelT(pixelY * info.destSizeReciprocal_v2.y), pixelSPerX(info.destSizeReciprocal_v2.x),
+		quadRatiosHomogeneousPerX(GLKVector3MultiplyScalar(GLKMatrix3GetColumn(info.surfaceSTToQuadRatios, 0), pixelSPerX)),
+		pixelsUntilResync(0)
+	{}
+	
+	inline GLKVector2 nextTexelUV()
+	{
+		if (pixelsUntilResync > 0) {
+			quadRatiosHomogeneous = GLKVector3Add(quadRatiosHomogeneous, quadRatiosHomogeneousPerX);
+			--pixelsUntilResync;
+		}
+		else {
+			quadRatiosHomogeneous = GLKMatrix3MultiplyVector3(info.surfaceSTToQuadRatios, GLKVector3Make(pixelX * pixelSPerX, pixelT, 1.0f));
+			pixelsUntilResync = pixelsUntilAlignedResync(pixelX);
+		}
+		++pixelX;
+		
+		if (!(quadRatiosHomogeneous.z > 0.0f)) // beyond the horizon (or degenerate)
+			return GLKVector2Invalid;
+		
+		float wReciprocal = 1.0f / quadRatiosHomogeneous.z;
+		return texelUVFromQuadRatios<tUVMode>(info, quadRatiosHomogeneous.x * wReciprocal, quadRatiosHomogeneous.y * wReciprocal);
+	}
+};
+
+/// Solves for the quad ratios of a point in the bilinear patch through the quad's points, given the patch's `k2·v² + k1·v + k0 = 0` quadratic in the aft-to-fore ratio `v`.
+/// 	Branch-free (only selects), so loops over batches of it vectorize.  Uses the numerically-stable form of the quadratic formula, so it degrades gracefully to the linear solution as the quad becomes a parallelogram (`k2` → 0).
+/// @arg delta: The point minus the aft-star point.
+/// @arg aftDelta, starDelta, skewDelta: aft-star → aft-port, aft-star → fore-star, and the non-parallelogram remainder (aft-star - aft-port + fore-port - fore-star).
+/// @return: Whether the patch covers the point (`false` for points the quadratic has no real root for).
+/// @source: https://iquilezles.org/articles/ibilinear/ (Inigo Quilez)
+static inline bool solveInverseBilinear(
+	const float k0, const float k1, const float k2,
+	const GLKVector2 delta, const GLKVector2 aftDelta, const GLKVector2 starDelta, const GLKVector2 skewDelta,
+	float *out_starToPortRatio, float *out_aftToForeRatio
+)
+{
+	float discriminant = k1 * k1 - 4.0f * k0 * k2;
+	bool hasRoots = discriminant >= 0.0f;
+	float discriminantSqrt = sqrtf(hasRoots ? discriminant : 0.0f);
+	
+	float q = -0.5f * (k1 + (k1 >= 0.0f ? discriminantSqrt : -discriminantSqrt));
+	float vA = k0 / q, // the root that stays finite as k2 → 0
+		vB = q / k2;
+	
+	// u from whichever of x or y has the larger denominator (selecting before dividing, so there's nothing conditional left to vectorize around)
+	float uDenomAX = aftDelta.x + skewDelta.x * vA, uDenomAY = aftDelta.y + skewDelta.y * vA;
+	bool useXForA = fabsf(uDenomAX) >= fabsf(uDenomAY);
+	float uA = (useXForA ? delta.x - starDelta.x * vA : delta.y - starDelta.y * vA) / (useXForA ? uDenomAX : uDenomAY);
+	float uDenomBX = aftDelta.x + skewDelta.x * vB, uDenomBY = aftDelta.y + skewDelta.y * vB;
+	bool useXForB = fabsf(uDenomBX) >= fabsf(uDenomBY);
+	float uB = (useXForB ? delta.x - starDelta.x * vB : delta.y - starDelta.y * vB) / (useXForB ? uDenomBX : uDenomBY);
+	
+	// (bitwise `&`s rather than `&&`s, so no short-circuit branches get in the way of vectorizing)
+	bool aInside = (uA >= 0.0f) & (uA <= 1.0f) & (vA >= 0.0f) & (vA <= 1.0f);
+	bool bInside = (uB >= 0.0f) & (uB <= 1.0f) & (vB >= 0.0f) & (vB <= 1.0f);
+	bool useB = !aInside & bInside;
+	
+	*out_starToPortRatio = useB ? uB : uA;
+	*out_aftToForeRatio = useB ? vB : vA;
+	return hasRoots & (q != 0.0f);
+}
+
+/// Evaluates the exact inverse-bilinear mapping along a dest row.
+/// 	The quadratic's `k0` & `k1` terms are linear in `pixelX` (and `k2` is constant), so they're hoisted into per-row bases & per-pixel steps.  Pixels are solved kBatchSize at a time by a branch-free loop the compiler can vectorize, then handed out one at a time.
+template<OutsideOfQuadUVMode tUVMode>
+struct QuadScanlineEvaluator<QuadMappingInverseBilinear, tUVMode> {
+	static const int kBatchSize = 16;
+	
+	const struct DestImageGenInfo &info;
+	
+	int pixelX;
+	const float pixelSPerX;
+	
+	const GLKVector2 aftDelta, starDelta, skewDelta;
+	const float k2;
+	float k0RowBase, k0PerX, k1RowBase, k1PerX;
+	float deltaY;
+	
+	float batchStarToPortRatios[kBatchSize], batchAftToForeRatios[kBatchSize];
+	int batchSolvable[kBatchSize];
+	int batchI;
+	
+	QuadScanlineEvaluator(const struct DestImageGenInfo &info, const int pixelY, const int startPixelX) :
+		info(info),
+		pixelX(startPixelX),
+		pixelSPerX(info.destSizeReciprocal_v2.x),
+		aftDelta(GLKVector2Subtract(info.pointAftPort, info.pointAftStar)),
+		starDelta(GLKVector2Subtract(info.pointForeStar, info.pointAftStar)),
+		skewDelta(GLKVector2Subtract(GLKVector2Subtract(info.pointForePort, info.pointForeStar), aftDelta)),
+		k2(GLKVector2CrossProduct(skewDelta, starDelta)),
+		batchI(kBatchSize)
+	{
+		// k0 = cross(delta, aftDelta), k1 = cross(aftDelta, starDelta) + cross(delta, skewDelta); with delta = (pixelX * pixelSPerX - aftStar.x, deltaY)
+		deltaY = pixelY * info.destSizeReciprocal_v2.y - info.pointAftStar.y;
+		k0RowBase = -info.pointAftStar.x * aftDelta.y - deltaY * aftDelta.x;
+		k0PerX = pixelSPerX * aftDelta.y;
+		k1RowBase = GLKVector2CrossProduct(aftDelta, starDelta) - info.pointAftStar.x * skewDelta.y - deltaY * skewDelta.x;
+		k1PerX = pixelSPerX * skewDelta.y;
+	}
+	
+	inline GLKVector2 nextTexelUV()
+	{
+		if (batchI == kBatchSize)
+			solveBatch();
+		
+		const int i = batchI++;
+		if (!batchSolvable[i])
+			return GLKVector2Invalid;
+		
+		return texelUVFromQuadRatios<tUVMode>(info, batchStarToPortRatios[i], batchAftToForeRatios[i]);
+	}
+	
+	void solveBatch()
+	{
+		for (int i = 0; i < kBatchSize; ++i) {
+			const float x = (float)(pixelX + i);
+			const GLKVector2 delta = GLKVector2Make(x * pixelSPerX - info.pointAftStar.x, deltaY);
+			batchSolvable[i] = solveInverseBilinear(
+				k0RowBase + x * k0PerX, k1RowBase + x * k1PerX, k2,
+				delta, aftDelta, starDelta, skewDelta,
+				&batchStarToPortRatios[i], &batchAftToForeRatios[i]
+			);
+		}
+		pixelX += kBatchSize;
+		batchI = 0;
+	}
+};
+
+/// @source: Real-Time Collision Detection by Christer Ericson (Morgan Kaufmann, 2005) - Chapter 3: A Math and Geometry Primer - Section 3.4 Barycentric Coordinates
+static inline GLKVector3 barycentricCoords2(const GLKVector2 point, const GLKVector2 tri[3])
+{
+	GLKVector2 v0 = GLKVector2Subtract(tri[1], tri[0]),
+		v1 = GLKVector2Subtract(tri[2], tri[0]),
+		v2 = GLKVector2Subtract(point, tri[0]);
+	
+	float d00 = GLKVector2DotProduct(v0, v0),
+		d01 = GLKVector2DotProduct(v0, v1),
+		d11 = GLKVector2DotProduct(v1, v1),
+		d20 = GLKVector2DotProduct(v2, v0),
+		d21 = GLKVector2DotProduct(v2, v1);
+	
+	float denomReciprocal = 1.0f / (d00 * d11 - d01 * d01);
+	float v = (d11 * d20 - d01 * d21) * denomReciprocal;
+	float w = (d00 * d21 - d01 * d20) * denomReciprocal;
+	
+	return GLKVector3Make(1.0f - v - w, v, w);
+}
+
+GLKVector2 surfaceSTToTexelUV_barycentricTri(const GLKVector2 surfaceST, const GLKVector2 pointSTs[3], const GLKVector2 pointUVs[3])
+{
+	GLKVector3 barycentricCoords = barycentricCoords2(surfaceST, pointSTs);
+	
+	GLKVector2 pointUVsPortioned[3] = {
+		GLKVector2MultiplyScalar(pointUVs[0], barycentricCoords.v[0]),
+		GLKVector2MultiplyScalar(pointUVs[1], barycentricCoords.v[1]),
+		GLKVector2MultiplyScalar(pointUVs[2], barycentricCoords.v[2])
+	};
+	
+	GLKVector2 texelUV = GLKVector2Add(GLKVector2Add(pointUVsPortioned[0], pointUVsPortioned[1]), pointUVsPortioned[2]);
+	return texelUV;
+}
+
+static const int kAftStarTriInQuadIndices[3] = { 0, 1, 2 };
+static const int kForePortTriInQuadIndices[3] = { 1, 3, 2 };
+
+GLKVector2 surfaceSTToTexelUV_barycentricQuad(const struct DestImageGenInfo &info, const GLKVector2 surfaceST)
+{
+	//// @source http://stackoverflow.com/questions/1560492/how-to-tell-whether-a-point-is-to-the-right-or-left-side-of-a-line
+	float lineVsPointCross = GLKVector2CrossProduct(
+		GLKVector2Subtract(info.pointForeStar, info.pointAftPort),
+		GLKVector2Subtract(surfaceST, info.pointAftPort)
+	);
+	bool inAftStarTri = lineVsPointCross > 0.0f;
+	
+	const int *triInQuadIndices = inAftStarTri ? kAftStarTriInQuadIndices : kForePortTriInQuadIndices;
+	return surfaceSTToTexelUV_barycentricTri(
+		surfaceST,
+		(GLKVector2[3]){
+			info.points[triInQuadIndices[0]],
+			info.points[triInQuadIndices[1]],
+			info.points[triInQuadIndices[2]]
+		},
+		(GLKVector2[3]){
+			info.pointUVs[triInQuadIndices[0]],
+			info.pointUVs[triInQuadIndices[1]],
+			info.pointUVs[triInQuadIndices[2]]
+		}
+	);
+}
+
+/// @return: The edge function of the line from `lineA` to `lineB`, as `x * s + y * t + z` coefficients, scaled so it evaluates to 1 at `unitPoint` (or all-zeros if `unitPoint` is on the line).
+static GLKVector3 edgeFunctionCoefficients(const GLKVector2 lineA, const GLKVector2 lineB, const GLKVector2 unitPoint)
+{
+	GLKVector2 lineDelta = GLKVector2Subtract(lineB, lineA);
+	float unitPointCross = GLKVector2CrossProduct(lineDelta, GLKVector2Subtract(unitPoint, lineA));
+	if (unitPointCross == 0.0f)
+		return GLKVector3Make(0.0f, 0.0f, 0.0f);
+	
+	// cross(lineDelta, point - lineA), expanded & divided through by unitPointCross
+	float perS = -lineDelta.y / unitPointCross, perT = lineDelta.x / unitPointCross;
+	return GLKVector3Make(perS, perT, -(perS * lineA.x + perT * lineA.y));
+}
+
+/// Sets `out_edges[0]` & `[1]` to the edge functions giving the barycentric coords for the triangle's 2nd & 3rd points (the same `v` & `w` barycentricCoords2() returns).
+static void barycentricEdgeFunctions(const GLKVector2 tri[3], GLKVector3 out_edges[2])
+{
+	out_edges[0] = edgeFunctionCoefficients(tri[2], tri[0], tri[1]);
+	out_edges[1] = edgeFunctionCoefficients(tri[0], tri[1], tri[2]);
+}
+
+static inline float evaluateEdgeFunction(const GLKVector3 edge, const GLKVector2 surfaceST)
+{
+	return edge.x * surfaceST.x + edge.y * surfaceST.y + edge.z;
+}
+
+static void setUpBarycentricQuadEdgeFunctions(struct DestImageGenInfo &info)
+{
+	const GLKVector2 aftStarTri[3] = { info.points[kAftStarTriInQuadIndices[0]], info.points[kAftStarTriInQuadIndices[1]], info.points[kAftStarTriInQuadIndices[2]] };
+	const GLKVector2 forePortTri[3] = { info.points[kForePortTriInQuadIndices[0]], info.points[kForePortTriInQuadIndices[1]], info.points[kForePortTriInQuadIndices[2]] };
+	barycentricEdgeFunctions(aftStarTri, info.aftStarTriBarycentricEdges);
+	barycentricEdgeFunctions(forePortTri, info.forePortTriBarycentricEdges);
+	
+	// surfaceSTToTexelUV_barycentricQuad()'s `lineVsPointCross`, but flipped if need be so it's positive on the aft-star side regardless of the quad's winding
+	GLKVector2 diagonalDelta = GLKVector2Subtract(info.pointForeStar, info.pointAftPort);
+	info.quadDiagonalEdge = GLKVector3Make(
+		-diagonalDelta.y, diagonalDelta.x,
+		diagonalDelta.y * info.pointAftPort.x - diagonalDelta.x * info.pointAftPort.y
+	);
+	if (evaluateEdgeFunction(info.quadDiagonalEdge, info.pointAftStar) < 0.0f)
+		info.quadDiagonalEdge = GLKVector3MultiplyScalar(info.quadDiagonalEdge, -1.0f);
+}
+
+/// @return: A half-plane given in surface ST (`x * s + y * t + z >= 0`), converted to dest pixels, scaled to pixel distances, and padded by kCoverageSpanPaddingPixels; or all-zeros (covering everything) if it's degenerate.
+static GLKVector3 coverageHalfPlaneInPixels(const struct DestImageGenInfo &info, const GLKVector3 surfaceSTHalfPlane)
+{
+	GLKVector2 pixelNormal = GLKVector2Multiply(GLKVector2Make(surfaceSTHalfPlane.x, surfaceSTHalfPlane.y), info.destSizeReciprocal_v2);
+	float pixelNormalLength = GLKVector2Length(pixelNormal);
+	if (pixelNormalLength == 0.0f)
+		return GLKVector3Make(0.0f, 0.0f, 0.0f);
+	
+	return GLKVector3Make(
+		pixelNormal.x / pixelNormalLength, pixelNormal.y / pixelNormalLength,
+		surfaceSTHalfPlane.z / pixelNormalLength + kCoverageSpanPaddingPixels
+	);
+}
+
+static void addCoverageConstraint(struct DestImageGenInfo &info, const GLKVector3 surfaceSTHalfPlaneA, const GLKVector3 surfaceSTHalfPlaneB)
+{
+	info.coverageConstraintHalfPlanes[info.coverageConstraintCount][0] = coverageHalfPlaneInPixels(info, surfaceSTHalfPlaneA);
+	info.coverageConstraintHalfPlanes[info.coverageConstraintCount][1] = coverageHalfPlaneInPixels(info, surfaceSTHalfPlaneB);
+	++info.coverageConstraintCount;
+}
+
+/// Sets up `info.coverageConstraintHalfPlanes` to bound the pixels the mapping could cover without skipping, wherever that can be done exactly:
+/// 	• QuadMappingBilinear's `u` is a lerp (by a `v` within [0, 1)) of the ratios along the aft & fore segments, so at least one of those must be >= 0 and at least one < 1.  (Which bounds it across those segments' direction, but not along the sides; the covered region can reach arbitrarily far out along them for some quads.)
+/// 	• The others stay within the points' convex hull: the inverse-bilinear patch always; the projective & barycentric mappings only when the quad's convex (otherwise a horizon, or the triangles folding over the diagonal, can put covered pixels outside it, so they get no bounds).
+template<QuadMappingMode tMappingMode>
+static void setUpCoverageConstraints(struct DestImageGenInfo &info)
+{
+	info.coverageConstraintCount = 0;
+	
+	if (tMappingMode == QuadMappingBilinear) {
+		GLKVector3 ratioHalfPlanesFrom0[2], ratioHalfPlanesUpTo1[2];
+		const GLKVector2 segmentStarts[2] = { info.pointAftStar, info.pointForeStar }, segmentDeltas[2] = { info.segmentAftDelta, info.segmentForeDelta };
+		for (int segmentI = 0; segmentI < 2; ++segmentI) {
+			const GLKVector2 delta = segmentDeltas[segmentI];
+			const float startDot = GLKVector2DotProduct(segmentStarts[segmentI], delta);
+			// dot(point - start, delta) >= 0, and <= dot(delta, delta)
+			ratioHalfPlanesFrom0[segmentI] = GLKVector3Make(delta.x, delta.y, -startDot);
+			ratioHalfPlanesUpTo1[segmentI] = GLKVector3Make(-delta.x, -delta.y, startDot + GLKVector2DotProduct(delta, delta));
+		}
+		addCoverageConstraint(info, ratioHalfPlanesFrom0[0], ratioHalfPlanesFrom0[1]);
+		addCoverageConstraint(info, ratioHalfPlanesUpTo1[0], ratioHalfPlanesUpTo1[1]);
+		return;
+	}
+	
+	if (tMappingMode != QuadMappingInverseBilinear) {
+		// (aft-star, aft-port, fore-port, fore-star: around the quad's perimeter)
+		static const int kPerimeterIndices[4] = { 0, 1, 3, 2 };
+		float firstTurn = 0.0f;
+		for (int cornerI = 0; cornerI < 4; ++cornerI) {
+			const GLKVector2 prevPoint = info.points[kPerimeterIndices[(cornerI + 3) % 4]],
+				point = info.points[kPerimeterIndices[cornerI]],
+				nextPoint = info.points[kPerimeterIndices[(cornerI + 1) % 4]];
+			float turn = GLKVector2CrossProduct(GLKVector2Subtract(point, prevPoint), GLKVector2Subtract(nextPoint, point));
+			if (cornerI == 0)
+				firstTurn = turn;
+			else if (!(turn * firstTurn > 0.0f))
+				return;
+		}
+	}
+	
+	// the hull's edges are the lines through 2 of the points with both others on one side
+	for (int pointAI = 0; pointAI < 4; ++pointAI) {
+		for (int pointBI = 0; pointBI < 4; ++pointBI) {
+			if (pointAI == pointBI)
+				continue;
+			const GLKVector2 pointA = info.points[pointAI], lineDelta = GLKVector2Subtract(info.points[pointBI], pointA);
+			bool isHullEdge = true;
+			for (int otherPointI = 0; otherPointI < 4; ++otherPointI) {
+				if (otherPointI != pointAI && otherPointI != pointBI && GLKVector2CrossProduct(lineDelta, GLKVector2Subtract(info.points[otherPointI], pointA)) <= 0.0f)
+					isHullEdge = false;
+			}
+			if (isHullEdge && info.coverageConstraintCount < 4) {
+				// cross(lineDelta, point - pointA) >= 0
+				GLKVector3 hullHalfPlane = GLKVector3Make(-lineDelta.y, lineDelta.x, -GLKVector2CrossProduct(lineDelta, pointA));
+				addCoverageConstraint(info, hullHalfPlane, hullHalfPlane);
+			}
+		}
+	}
+}
+
+/// @return: Whether any of row `pixelY` is within `halfPlane`, and if so the range of `pixelX` (`[*out_startX, *out_endX)`, unbounded as ±FLT_MAX) that is.
+static inline bool rowSpanInHalfPlane(const GLKVector3 halfPlane, const int pixelY, float *out_startX, float *out_endX)
+{
+	const float rowValue = halfPlane.y * pixelY + halfPlane.z;
+	*out_startX = -FLT_MAX;
+	*out_endX = FLT_MAX;
+	// x * pixelX + rowValue >= 0
+	if (halfPlane.x > 0.0f)
+		*out_startX = ceilf(-rowValue / halfPlane.x);
+	else if (halfPlane.x < 0.0f)
+		*out_endX = floorf(-rowValue / halfPlane.x) + 1.0f;
+	else
+		return rowValue >= 0.0f;
+	return true;
+}
+
+/// Narrows `[*io_startX, *io_endX)` to the pixels of row `pixelY` that could be within one of each of `info.coverageConstraintHalfPlanes` pairs (the span between both half-planes' spans, for each pair).
+static inline void narrowSpanToCoverage(const struct DestImageGenInfo &info, const int pixelY, int *io_startX, int *io_endX)
+{
+	float startX = *io_startX, endX = *io_endX;
+	for (int constraintI = 0; constraintI < info.coverageConstraintCount; ++constraintI) {
+		float startXA, endXA, startXB, endXB;
+		bool inA = rowSpanInHalfPlane(info.coverageConstraintHalfPlanes[constraintI][0], pixelY, &startXA, &endXA),
+			inB = rowSpanInHalfPlane(info.coverageConstraintHalfPlanes[constraintI][1], pixelY, &startXB, &endXB);
+		if (inA && inB) {
+			startX = fmaxf(startX, fminf(startXA, startXB));
+			endX = fminf(endX, fmaxf(endXA, endXB));
+		}
+		else if (inA || inB) {
+			startX = fmaxf(startX, inA ? startXA : startXB);
+			endX = fminf(endX, inA ? endXA : endXB);
+		}
+		else {
+			endX = startX;
+		}
+	}
+	// (clamped as floats first, so far-off bounds can't overflow the int conversion)
+	*io_endX = (int)clamp_f(endX, *io_startX, *io_endX);
+	*io_startX = (int)clamp_f(startX, *io_startX, *io_endX);
+}
+
+/// Sets up `info.antialiasesEdges` (& the rest with it) for OutsideOfQuadUVSkip, per `options`: the quad's edges, from its `points` (unshifted, so each pixel's coverage is of its own square, `[pixelX, pixelX + 1) × [pixelY, pixelY + 1)`, whatever the filter mode samples it at).  Quads that aren't convex (or are degenerate) aren't antialiased; their covered region isn't the one polygon.
+static void setUpAntialiasedEdges(struct DestImageGenInfo &info, const GLKVector2 points[4], const CGTextureMappingOptions &options)
+{
+	info.antialiasesEdges = false;
+	if (!options.antialiasesEdges)
+		return;
+	
+	// (aft-star, aft-port, fore-port, fore-star: around the quad's perimeter)
+	static const int kPerimeterIndices[4] = { 0, 1, 3, 2 };
+	const GLKVector2 destSize = GLKVector2Make(info.destWidth_i, info.destHeight_i);
+	GLKVector2 pixelPoints[4];
+	for (int cornerI = 0; cornerI < 4; ++cornerI)
+		pixelPoints[cornerI] = GLKVector2Multiply(points[kPerimeterIndices[cornerI]], destSize);
+	
+	float firstTurn = 0.0f;
+	for (int cornerI = 0; cornerI < 4; ++cornerI) {
+		const GLKVector2 prevPoint = pixelPoints[(cornerI + 3) % 4], point = pixelPoints[cornerI], nextPoint = pixelPoints[(cornerI + 1) % 4];
+		const float turn = GLKVector2CrossProduct(GLKVector2Subtract(point, prevPoint), GLKVector2Subtract(nextPoint, point));
+		if (cornerI == 0)
+			firstTurn = turn;
+		else if (!(turn * firstTurn > 0.0f))
+			return;
+	}
+	
+	for (int edgeI = 0; edgeI < 4; ++edgeI) {
+		const GLKVector2 point = pixelPoints[edgeI], edgeDelta = GLKVector2Subtract(pixelPoints[(edgeI + 1) % 4], point);
+		// cross(edgeDelta, pixel - point) on the side the quad turns to, per unit of the edge's length
+		const float scale = ((firstTurn > 0.0f) ? 1.0f : -1.0f) / GLKVector2Length(edgeDelta);
+		info.antialiasedEdgeHalfPlanes[edgeI] = GLKVector3Make(-edgeDelta.y * scale, edgeDelta.x * scale, -GLKVector2CrossProduct(edgeDelta, point) * scale);
+	}
+	info.antialiasesEdges = true;
+	info.edgeCoverageBytes = options.edgeCoverageBytes;
+}
+
+/// How far inside every edge (in pixels) a pixel's square must be to be drawn as wholly covered, rather than as an edge pixel: a little, so the squares the edges just graze, rounded either way, are all drawn as edge pixels.
+static const float kAntialiasedInteriorMarginPixels = 1.0f / 64;
+
+/// Splits `[startX, endX)` of row `pixelY` by how the quad's antialiased edges cross it: into the pixels whose squares are wholly within the quad, `[*out_interiorStartX, *out_interiorEndX)`, and either side of those up to `[*out_edgeStartX, *out_edgeEndX)`, the ones an edge crosses (or that are just outside the quad).  The pixels outside the latter are wholly outside the quad.
+static inline void antialiasedRowSpans(const struct DestImageGenInfo &info, const int pixelY, const int startX, const int endX, int *out_edgeStartX, int *out_interiorStartX, int *out_interiorEndX, int *out_edgeEndX)
+{
+	float edgeStartX = startX, edgeEndX = endX, interiorStartX = startX, interiorEndX = endX;
+	for (int edgeI = 0; edgeI < 4; ++edgeI) {
+		const GLKVector3 halfPlane = info.antialiasedEdgeHalfPlanes[edgeI];
+		// the half-plane where a pixel's square reaches inside the edge (its corner furthest inside being inside), and where all of it's inside (its corner furthest outside being inside)
+		const GLKVector3 reachesInsideHalfPlane = GLKVector3Make(halfPlane.x, halfPlane.y, halfPlane.z + fmaxf(halfPlane.x, 0.0f) + fmaxf(halfPlane.y, 0.0f)),
+			whollyInsideHalfPlane = GLKVector3Make(halfPlane.x, halfPlane.y, halfPlane.z + fminf(halfPlane.x, 0.0f) + fminf(halfPlane.y, 0.0f) - kAntialiasedInteriorMarginPixels);
+		float spanStartX, spanEndX;
+		if (rowSpanInHalfPlane(reachesInsideHalfPlane, pixelY, &spanStartX, &spanEndX)) {
+			edgeStartX = fmaxf(edgeStartX, spanStartX);
+			edgeEndX = fminf(edgeEndX, spanEndX);
+		}
+		else
+			edgeEndX = edgeStartX;
+		if (rowSpanInHalfPlane(whollyInsideHalfPlane, pixelY, &spanStartX, &spanEndX)) {
+			interiorStartX = fmaxf(interiorStartX, spanStartX);
+			interiorEndX = fminf(interiorEndX, spanEndX);
+		}
+		else
+			interiorEndX = interiorStartX;
+	}
+	// (clamped as floats first, so far-off bounds can't overflow the int conversion; an empty interior leaving the edge pixels all on its far side)
+	*out_edgeStartX = (int)clamp_f(edgeStartX, startX, endX);
+	*out_edgeEndX = (int)clamp_f(edgeEndX, *out_edgeStartX, endX);
+	if (interiorStartX < interiorEndX) {
+		*out_interiorStartX = (int)clamp_f(interiorStartX, *out_edgeStartX, *out_edgeEndX);
+		*out_interiorEndX = (int)clamp_f(interiorEndX, *out_interiorStartX, *out_edgeEndX);
+	}
+	else
+		*out_interiorStartX = *out_interiorEndX = *out_edgeEndX;
+}
+
+/// @return: How much of pixel (pixelX, pixelY)'s square is within the quad, in 1/255ths: the square clipped by each of `info.antialiasedEdgeHalfPlanes` in turn (relative to the pixel, so big dests don't lose precision), and the area of what's left.
+static inline int antialiasedEdgeCoverage(const struct DestImageGenInfo &info, const int pixelX, const int pixelY)
+{
+	// (each clip adding one vertex at most)
+	GLKVector2 polygons[2][8] = { { GLKVector2Make(0.0f, 0.0f), GLKVector2Make(1.0f, 0.0f), GLKVector2Make(1.0f, 1.0f), GLKVector2Make(0.0f, 1.0f) } };
+	int vertexCount = 4, polygonI = 0;
+	for (int edgeI = 0; edgeI < 4 && vertexCount > 0; ++edgeI) {
+		const GLKVector3 halfPlane = info.antialiasedEdgeHalfPlanes[edgeI];
+		const float pixelValue = halfPlane.x * pixelX + halfPlane.y * pixelY + halfPlane.z;
+		const GLKVector2 *vertices = polygons[polygonI];
+		GLKVector2 *clippedVertices = polygons[1 - polygonI];
+		int clippedVertexCount = 0;
+		for (int vertexI = 0; vertexI < vertexCount; ++vertexI) {
+			const GLKVector2 vertex = vertices[vertexI], nextVertex = vertices[(vertexI + 1) % vertexCount];
+			const float value = halfPlane.x * vertex.x + halfPlane.y * vertex.y + pixelValue,
+				nextValue = halfPlane.x * nextVertex.x + halfPlane.y * nextVertex.y + pixelValue;
+			if (value >= 0.0f)
+				clippedVertices[clippedVertexCount++] = vertex;
+			if ((value >= 0.0f) != (nextValue >= 0.0f))
+				clippedVertices[clippedVertexCount++] = GLKVector2Lerp(vertex, nextVertex, value / (value - nextValue));
+		}
+		vertexCount = clippedVertexCount;
+		polygonI = 1 - polygonI;
+	}
+	
+	float doubleArea = 0.0f;
+	const GLKVector2 *vertices = polygons[polygonI];
+	for (int vertexI = 0; vertexI < vertexCount; ++vertexI)
+		doubleArea += GLKVector2CrossProduct(vertices[vertexI], vertices[(vertexI + 1) % vertexCount]);
+	return (int)(fminf(fabsf(doubleArea) * 0.5f, 1.0f) * 255.0f + 0.5f);
+}
+
+/// @return: Whether `fourthPoint` completes the parallelogram started by the other three, within `tolerance` after scaling by `scale`.
+static inline bool completesParallelogram(const GLKVector2 cornerPoint, const GLKVector2 sidePointA, const GLKVector2 sidePointB, const GLKVector2 fourthPoint, const GLKVector2 scale, const float tolerance)
+{
+	GLKVector2 miss = GLKVector2Subtract(GLKVector2Add(cornerPoint, fourthPoint), GLKVector2Add(sidePointA, sidePointB));
+	GLKVector2 scaledMiss = GLKVector2Multiply(miss, scale);
+	return fabsf(scaledMiss.x) <= tolerance && fabsf(scaledMiss.y) <= tolerance;
+}
+
+/// Sets `info.isSeparable` and, if so, `info.separableAxisMappings`, from the affine mapping.
+/// 	Each src axis must be read through exactly one quad ratio, which must depend on exactly one dest axis, and the two dest axes must be different.  Tests are for exact zeros (which axis-aligned points & UVs give us), so the separable paths' output matches the affine path's.
+static void setUpSeparableAxisMappings(struct DestImageGenInfo &info)
+{
+	const GLKVector3 ratioEdges[2] = { info.affineStarToPortRatioEdge, info.affineAftToForeRatioEdge };
+	const GLKVector2 uvPerRatios[2] = { info.affineUVPerStarToPortRatio, info.affineUVPerAftToForeRatio };
+	
+	bool destAxisMapped[2] = { false, false };
+	for (int srcAxis = 0; srcAxis < 2; ++srcAxis) {
+		int ratioI = -1;
+		for (int candidateRatioI = 0; candidateRatioI < 2; ++candidateRatioI) {
+			if (uvPerRatios[candidateRatioI].v[srcAxis] == 0.0f)
+				continue;
+			if (ratioI >= 0) { // read through both ratios
+				info.isSeparable = false;
+				return;
+			}
+			ratioI = candidateRatioI;
+		}
+		if (ratioI < 0) {
+			info.isSeparable = false;
+			return;
+		}
+		
+		const GLKVector3 ratioEdge = ratioEdges[ratioI];
+		const int destAxis = (ratioEdge.y == 0.0f) ? 0 : (ratioEdge.x == 0.0f) ? 1 : -1;
+		if (destAxis < 0 || destAxisMapped[destAxis]) {
+			info.isSeparable = false;
+			return;
+		}
+		destAxisMapped[destAxis] = true;
+		
+		struct SeparableAxisMapping axisMapping = {
+			/* ratioPerST: */ ratioEdge.v[destAxis], /* ratioBase: */ ratioEdge.z,
+			/* uv0: */ info.pointUV0.v[srcAxis], /* uvPerRatio: */ uvPerRatios[ratioI].v[srcAxis],
+			srcAxis
+		};
+		info.separableAxisMappings[destAxis] = axisMapping;
+	}
+	info.isSeparable = true;
+}
+
+/// When both the quad and its UVs are parallelograms, the projective, barycentric, and inverse-bilinear mappings all reduce to the same affine mapping (the quad ratios are just the aft-star triangle's barycentric coords).  Sets `info.isAffine` and, if so, the affine coefficients.
+/// 	QuadMappingBilinear finds its ratios by perpendicular projection onto the aft & fore segments, which only agrees with this for rectangles, so `requireRectangle` should be set for it.
+static void setUpAffineMappingIfParallelogram(struct DestImageGenInfo &info, const bool requireRectangle)
+{
+	const GLKVector2 destSize = GLKVector2Make(info.destWidth_i, info.destHeight_i);
+	const GLKVector2 aftSegmentPixels = GLKVector2Multiply(GLKVector2Subtract(info.pointAftPort, info.pointAftStar), destSize),
+		starSegmentPixels = GLKVector2Multiply(GLKVector2Subtract(info.pointForeStar, info.pointAftStar), destSize);
+	
+	info.isAffine = (
+		completesParallelogram(info.pointAftStar, info.pointAftPort, info.pointForeStar, info.pointForePort, destSize, kAffineParallelogramTolerance) &&
+		completesParallelogram(info.pointUV0, info.pointUV1, info.pointUV2, info.pointUV3, info.srcSize_v2, kAffineParallelogramTolerance) &&
+		GLKVector2CrossProduct(aftSegmentPixels, starSegmentPixels) != 0.0f &&
+		(!requireRectangle || fabsf(GLKVector2DotProduct(aftSegmentPixels, starSegmentPixels)) <= kAffineParallelogramTolerance * GLKVector2Length(aftSegmentPixels))
+	);
+	info.isSeparable = false;
+	if (!info.isAffine)
+		return;
+	
+	info.affineStarToPortRatioEdge = edgeFunctionCoefficients(info.pointForeStar, info.pointAftStar, info.pointAftPort);
+	info.affineAftToForeRatioEdge = edgeFunctionCoefficients(info.pointAftStar, info.pointAftPort, info.pointForeStar);
+	info.affineUVPerStarToPortRatio = GLKVector2Subtract(info.pointUV1, info.pointUV0);
+	info.affineUVPerAftToForeRatio = GLKVector2Subtract(info.pointUV2, info.pointUV0);
+	
+	setUpSeparableAxisMappings(info);
+}
+
+static inline GLKVector2 affineUVFromQuadRatios(const struct DestImageGenInfo &info, const float starToPortRatio, const float aftToForeRatio)
+{
+	return GLKVector2Add(info.pointUV0, GLKVector2Add(
+		GLKVector2MultiplyScalar(info.affineUVPerStarToPortRatio, starToPortRatio),
+		GLKVector2MultiplyScalar(info.affineUVPerAftToForeRatio, aftToForeRatio)
+	));
+}
+
+/// Narrows `[*io_startX, *io_endX)` to the pixels where `base + pixelX * perX` is within [0, 1) (a contiguous run, since it's monotonic in `pixelX`).
+/// 	The bounds are solved for directly, then settled by evaluating the same expression at them, so the result agrees exactly with per-pixel evaluation.
+static inline void narrowSpanToLinearInRange0To1(const float base, const float perX, int *io_startX, int *io_endX)
+{
+	int startX = *io_startX, endX = *io_endX;
+	if (perX == 0.0f) {
+		if (!inRange0ToJustUnder1_f(base))
+			endX = startX;
+	}
+	else {
+		float zeroX = -base / perX, oneX = (1.0f - base) / perX;
+		float lowX = fminf(zeroX, oneX), highX = fmaxf(zeroX, oneX);
+		// (clamped as floats first, so far-off bounds can't overflow the int conversion)
+		startX = (int)clamp_f(floorf(lowX) - 1.0f, startX, endX);
+		endX = (int)clamp_f(ceilf(highX) + 1.0f, startX, endX);
+		while (startX < endX && !inRange0ToJustUnder1_f(base + startX * perX))
+			++startX;
+		while (endX > startX && !inRange0ToJustUnder1_f(base + (endX - 1) * perX))
+			--endX;
+		// widen back out in case the solved bounds were off by more than the pad
+		while (startX > *io_startX && inRange0ToJustUnder1_f(base + (startX - 1) * perX))
+			--startX;
+		while (endX < *io_endX && inRange0ToJustUnder1_f(base + endX * perX))
+			++endX;
+	}
+	*io_startX = startX;
+	*io_endX = endX;
+}
+
+/// Which wrap period a coord is in (its floor), or for clamping which side of [0, 1) it's on (-1, 0, or 1); within a period, normalizing the coord is a fixed offset or a fixed value.
+static inline float normalizationPeriod(const float coord, const bool wraps)
+{
+	if (wraps)
+		return floorf(coord);
+	return (coord < 0.0f) ? -1.0f : (coord < 1.0f) ? 0.0f : 1.0f;
+}
+
+/// A coord's normalization within one normalizationPeriod(), as `coord * keep - shift`: `keep` 1 & `shift` the whole periods to drop when wrapping (or inside the range), or `keep` 0 & `shift` minus the edge value when clamped.
+struct PeriodNormalization {
+	float keep, shift;
+};
+
+static inline struct PeriodNormalization periodNormalization(const float period, const bool wraps)
+{
+	struct PeriodNormalization normalization = { 1.0f, wraps ? period : 0.0f };
+	if (!wraps && period != 0.0f) {
+		normalization.keep = 0.0f;
+		normalization.shift = (period < 0.0f) ? 0.0f : -kJustUnder1_0f;
+	}
+	return normalization;
+}
+
+/// @return: The end of the run of pixels from `startX` (up to `endX`) over which `base + pixelX * perX` stays in the same normalizationPeriod().
+/// 	Solved for directly, then settled by evaluating the same expression either side of it, like narrowSpanToLinearInRange0To1().
+static inline int normalizationPeriodEndX(const float base, const float perX, const int startX, const int endX, const bool wraps)
+{
+	const float period = normalizationPeriod(base + startX * perX, wraps);
+	// the boundary crossed leaving the period in the direction of travel; there's none past the clamped sides
+	bool hasBoundary;
+	float boundary;
+	if (perX > 0.0f) {
+		hasBoundary = wraps || period < 1.0f;
+		boundary = period + 1.0f;
+	}
+	else if (perX < 0.0f) {
+		hasBoundary = wraps || period > -1.0f;
+		boundary = period;
+	}
+	else {
+		hasBoundary = false;
+	}
+	if (!hasBoundary)
+		return endX;
+	
+	// (clamped as a float first, so a far-off boundary can't overflow the int conversion)
+	int periodEndX = (int)clamp_f(ceilf((boundary - base) / perX), startX + 1, endX);
+	while (periodEndX > startX + 1 && normalizationPeriod(base + (periodEndX - 1) * perX, wraps) != period)
+		--periodEndX;
+	while (periodEndX < endX && normalizationPeriod(base + periodEndX * perX, wraps) == period)
+		++periodEndX;
+	return periodEndX;
+}
+
+/// Evaluates the two-triangle barycentric mapping along a dest row, using the edge functions precomputed into `info` by setUpBarycentricQuadEdgeFunctions().
+/// 	The edge functions (and so the barycentric coords and the diagonal side test) are linear in `pixelX`, so they're all stepped with adds (resyncing every kScanlineResyncInterval pixels); no per-pixel dot products or reciprocals.
+template<OutsideOfQuadUVMode tUVMode>
+struct QuadScanlineEvaluator<QuadMappingBarycentric, tUVMode> {
+	const struct DestImageGenInfo &info;
+	
+	int pixelX;
+	const float pixelT, pixelSPerX;
+	
+	/// [0]: diagonal side, [1] & [2]: aft-star tri barycentrics, [3] & [4]: fore-port tri barycentrics
+	float edgeValues[5], edgeValuesPerX[5];
+	int pixelsUntilResync;
+	
+	QuadScanlineEvaluator(const struct DestImageGenInfo &info, const int pixelY, const int startPixelX) :
+		info(info),
+		pixelX(startPixelX),
+		pixelT(pixelY * info.destSizeReciprocal_v2.y), pixelSPerX(info.destSizeReciprocal_v2.x),
+		pixelsUntilResync(0)
+	{
+		edgeValuesPerX[0] = info.quadDiagonalEdge.x * pixelSPerX;
+		edgeValuesPerX[1] = info.aftStarTriBarycentricEdges[0].x * pixelSPerX;
+		edgeValuesPerX[2] = info.aftStarTriBarycentricEdges[1].x * pixelSPerX;
+		edgeValuesPerX[3] = info.forePortTriBarycentricEdges[0].x * pixelSPerX;
+		edgeValuesPerX[4] = info.forePortTriBarycentricEdges[1].x * pixelSPerX;
+	}
+	
+	inline GLKVector2 nextTexelUV()
+	{
+		if (pixelsUntilResync > 0) {
+			for (int edgeI = 0; edgeI < 5; ++edgeI)
+				edgeValues[edgeI] += edgeValuesPerX[edgeI];
+			--pixelsUntilResync;
+		}
+		else {
+			const GLKVector2 surfaceST = GLKVector2Make(pixelX * pixelSPerX, pixelT);
+			edgeValues[0] = evaluateEdgeFunction(info.quadDiagonalEdge, surfaceST);
+			edgeValues[1] = evaluateEdgeFunction(info.aftStarTriBarycentricEdges[0], surfaceST);
+			edgeValues[2] = evaluateEdgeFunction(info.aftStarTriBarycentricEdges[1], surfaceST);
+			edgeValues[3] = evaluateEdgeFunction(info.forePortTriBarycentricEdges[0], surfaceST);
+			edgeValues[4] = evaluateEdgeFunction(info.forePortTriBarycentricEdges[1], surfaceST);
+			pixelsUntilResync = pixelsUntilAlignedResync(pixelX);
+		}
+		++pixelX;
+		
+		bool inAftStarTri = edgeValues[0] > 0.0f;
+		if (inAftStarTri) {
+			// aft-star, aft-port, fore-star: quad ratios (0,0), (1,0), (0,1)
+			return texelUVFromQuadRatios<tUVMode>(info, edgeValues[1], edgeValues[2]);
+		}
+		else {
+			// aft-port, fore-port, fore-star: quad ratios (1,0), (1,1), (0,1)
+			return texelUVFromQuadRatios<tUVMode>(info, 1.0f - edgeValues[4], edgeValues[3] + edgeValues[4]);
+		}
+	}
+};
+
+/// @return: The UV the mapping gives `surfaceST` before any OutsideOfQuadUVMode normalization— the quad ratios left unwrapped & unclamped, so the UVs carry on smoothly past the quad's edges, where wrapping or clamping them would jump— or GLKVector2Invalid where the mapping has none (beyond a projective mapping's horizon, or where an inverse-bilinear patch has no solution).  For estimating the mapping's UV derivatives.
+template<QuadMappingMode tMappingMode> GLKVector2 unnormalizedTexelUV(const struct DestImageGenInfo &info, const GLKVector2 surfaceST);
+template<> inline GLKVector2 unnormalizedTexelUV<QuadMappingBilinear>(const struct DestImageGenInfo &info, const GLKVector2 surfaceST)
+{
+	GLKVector2 nearestPointOnAft, nearestPointOnFore;
+	float ratioAlongAft = ratioAndNearestPointAlongSegment(
+		surfaceST,
+		info.pointAftStar, info.pointAftPort,
+		info.segmentAftDelta, info.segmentAftLengthSqr,
+		&nearestPointOnAft
+	);
+	float ratioAlongFore = ratioAndNearestPointAlongSegment(
+		surfaceST,
+		info.pointForeStar, info.pointForePort,
+		info.segmentForeDelta, info.segmentForeLengthSqr,
+		&nearestPointOnFore
+	);
+	
+	float ratioAlongNearestAftToNearestFore = ratioAlongSegment(surfaceST, nearestPointOnAft, nearestPointOnFore);
+	return lerpPointUVs(info, ratioAlongAft + (ratioAlongFore - ratioAlongAft) * ratioAlongNearestAftToNearestFore, ratioAlongNearestAftToNearestFore);
+}
+template<> inline GLKVector2 unnormalizedTexelUV<QuadMappingProjective>(const struct DestImageGenInfo &info, const GLKVector2 surfaceST)
+{
+	GLKVector3 quadRatiosHomogeneous = GLKMatrix3MultiplyVector3(info.surfaceSTToQuadRatios, GLKVector3Make(surfaceST.x, surfaceST.y, 1.0f));
+	if (!(quadRatiosHomogeneous.z > 0.0f)) // beyond the horizon (or degenerate)
+		return GLKVector2Invalid;
+	
+	float wReciprocal = 1.0f / quadRatiosHomogeneous.z;
+	return lerpPointUVs(info, quadRatiosHomogeneous.x * wReciprocal, quadRatiosHomogeneous.y * wReciprocal);
+}
+template<> inline GLKVector2 unnormalizedTexelUV<QuadMappingBarycentric>(const struct DestImageGenInfo &info, const GLKVector2 surfaceST)
+{
+	return surfaceSTToTexelUV_barycentricQuad(info, surfaceST);
+}
+template<> inline GLKVector2 unnormalizedTexelUV<QuadMappingInverseBilinear>(const struct DestImageGenInfo &info, const GLKVector2 surfaceST)
+{
+	const GLKVector2 aftDelta = GLKVector2Subtract(info.pointAftPort, info.pointAftStar),
+		starDelta = GLKVector2Subtract(info.pointForeStar, info.pointAftStar),
+		skewDelta = GLKVector2Subtract(GLKVector2Subtract(info.pointForePort, info.pointForeStar), aftDelta);
+	const GLKVector2 delta = GLKVector2Subtract(surfaceST, info.pointAftStar);
+	
+	float starToPortRatio, aftToForeRatio;
+	bool isSolvable = solveInverseBilinear(
+		GLKVector2CrossProduct(delta, aftDelta), GLKVector2CrossProduct(aftDelta, starDelta) + GLKVector2CrossProduct(delta, skewDelta), GLKVector2CrossProduct(skewDelta, starDelta),
+		delta, aftDelta, starDelta, skewDelta,
+		&starToPortRatio, &aftToForeRatio
+	);
+	if (!isSolvable)
+		return GLKVector2Invalid;
+	
+	return lerpPointUVs(info, starToPortRatio, aftToForeRatio);
+}
+
+template<int tComponentCount> void copyBytesToPixelFromTexel(UInt8 *texelBytes, const UInt8 *pixelBytes);
+template<> inline void copyBytesToPixelFromTexel<1>(UInt8 *pixelBytes, const UInt8 *texelBytes)
+{
+	pixelBytes[0] = texelBytes[0];
+}
+template<> inline void copyBytesToPixelFromTexel<2>(UInt8 *pixelBytes, const UInt8 *texelBytes)
+{
+	pixelBytes[0] = texelBytes[0];
+	pixelBytes[1] = texelBytes[1];
+}
+template<> inline void copyBytesToPixelFromTexel<3>(UInt8 *pixelBytes, const UInt8 *texelBytes)
+{
+	pixelBytes[0] = texelBytes[0];
+	pixelBytes[1] = texelBytes[1];
+	pixelBytes[2] = texelBytes[2];
+}
+template<> inline void copyBytesToPixelFromTexel<4>(UInt8 *pixelBytes, const UInt8 *texelBytes)
+{
+	pixelBytes[0] = texelBytes[0];
+	pixelBytes[1] = texelBytes[1];
+	pixelBytes[2] = texelBytes[2];
+	pixelBytes[3] = texelBytes[3];
+}
+
+/// @return: The index of the texel containing `texelCoord` (in texels, not normalized), i.e. its floor.
+static inline int nearestTexelIndex(const float texelCoord)
+{
+	const int truncatedCoord = (int)texelCoord;
+	return (texelCoord < truncatedCoord) ? truncatedCoord - 1 : truncatedCoord;
+}
+
+/// Sets up a TexelWrapPeriod of `period`, biased by `biasPeriodCount` periods.
+/// 	The magic multiplier is `ceil(2^(31 + periodBits) / period)`, `periodBits` being enough bits for `period - 1`.  That fits 32 bits, as `period` is over `2^(periodBits - 1)` (or is a power of two, making it 2^31); and it's less than 1 over the exact `2^(31 + periodBits) / period`, which (times a coord below 2^31, shifted down by `31 + periodBits`) adds less than `1 / period` to the quotient: too little to carry any remainder up to the next whole one.  (Hacker's Delight, 2nd ed., 10–8: Unsigned Division by Divisors ≥ 1.)
+static struct TexelWrapPeriod texelWrapPeriod(const int period, const int biasPeriodCount)
+{
+	struct TexelWrapPeriod wrapPeriod = { period, 0, 0, biasPeriodCount * period };
+	if (period >= 2) {
+		const int periodBits = 32 - __builtin_clz(period - 1);
+		wrapPeriod.magicMultiplier = (uint32_t)((((uint64_t)1 << (31 + periodBits)) + period - 1) / period);
+		wrapPeriod.magicShift = periodBits - 1;
+	}
+	return wrapPeriod;
+}
+
+/// @return: `coord` modulo `wrapPeriod.period`, for coords within [0, 2^31) (biased by `wrapPeriod.bias`, that is).
+template<TexelWrapDivisor tWrapDivisor> int wrapTexelCoord(const int coord, const struct TexelWrapPeriod &wrapPeriod);
+template<> inline int wrapTexelCoord<TexelWrapDivisorPowerOfTwo>(const int coord, const struct TexelWrapPeriod &wrapPeriod)
+{
+	return coord & (wrapPeriod.period - 1);
+}
+template<> inline int wrapTexelCoord<TexelWrapDivisorMagicNumber>(const int coord, const struct TexelWrapPeriod &wrapPeriod)
+{
+	const int quotient = (int)(((uint64_t)(uint32_t)coord * wrapPeriod.magicMultiplier) >> 32 >> wrapPeriod.magicShift);
+	return coord - quotient * wrapPeriod.period;
+}
+
+/// @return: The part of a src texel's index (into `info.srcBytes`, in texels) that comes from its index `texelI` along axis `axisI`, per `tLayout`; the two axes' parts summing to the whole index.
+template<TexelLayout tLayout>
+inline size_t texelAxisIndex(const struct DestImageGenInfo &info, const int texelI, const int axisI)
+{
+	if (tLayout == TexelLayoutTiled)
+		return (axisI == 0) ? tiledTexelIndexX(texelI) : tiledTexelIndexY(texelI, info.srcTileRowTexelCount);
+	return (axisI == 0) ? (size_t)texelI : (size_t)texelI * info.srcWidth_i;
+}
+
+/// @return: The index (into `info.srcBytes`, in texels) of the src texel at `(texelX, texelY)`, per `tLayout`.
+template<TexelLayout tLayout>
+inline size_t texelIndex(const struct DestImageGenInfo &info, const int texelX, const int texelY)
+{
+	return texelAxisIndex<tLayout>(info, texelY, 1) + texelAxisIndex<tLayout>(info, texelX, 0);
+}
+
+/// Nearest-texel sample of the src image at `texelST`, normalized per `tSTMode`: wrapped as an integer texel index (see wrapTexelCoord()) when `info.texelCoordsWrapAsInts`, or as a float ST otherwise, as it's clamped.
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+inline void sampleTexelBytes(const struct DestImageGenInfo &info, GLKVector2 texelST, UInt8 *pixelByteBuffer)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	const bool wrapsAsInts = (tSTMode == OutsideOfTextureSTWrap && info.texelCoordsWrapAsInts);
+	if (!wrapsAsInts)
+		normalizeTexelST<tSTMode>(texelST.v);
+	
+	GLKVector2 texelXY = GLKVector2Multiply(texelST, info.srcSize_v2);
+	int nearestTexelX = nearestTexelIndex(texelXY.x),
+		nearestTexelY = nearestTexelIndex(texelXY.y);
+	if (wrapsAsInts) {
+		nearestTexelX = wrapTexelCoord<tWrapDivisor>(nearestTexelX + info.texelWrapPeriods[0].bias, info.texelWrapPeriods[0]);
+		nearestTexelY = wrapTexelCoord<tWrapDivisor>(nearestTexelY + info.texelWrapPeriods[1].bias, info.texelWrapPeriods[1]);
+	}
+	
+	const UInt8 *texelBytes = &info.srcBytes[texelIndex<tLayout>(info, nearestTexelX, nearestTexelY) * kBytesPerPixel];
+	
+	//UInt8 nearestTexelSample[kBytesPerPixel];
+	copyBytesToPixelFromTexel<tComponentCount>(pixelByteBuffer, texelBytes);
+	
+	// @debug: show UVs directly
+	//pixelByteBuffer[0] = fabsf(texelST.x) * 255.0f;
+	//pixelByteBuffer[1] = fabsf(texelST.y) * 255.0f;
+	//pixelByteBuffer[2] = (texelST.x < 0 ? 127 : 0) + (texelST.y < 0 ? 127 : 0);
+	//pixelByteBuffer[3] = 255;
+}
+
+/// Sets `info.texelFractionBits`, `info.texelCoordsWrapAsInts` & the texel wrap periods (and the rest of the fixed-point texel coord setup), giving fixed-point coords as many fraction bits as `requestedFractionBits` (0 for float coords) less as many as they need to stay within kFixedPointTexelCoordBits (after biasing, for wrapping)— or none, if that's fewer than kMinFixedPointFractionBits.
+/// 	The texel coords come from UVs within the pointUVs' range (clamping & wrapping the quad ratios, or skipping outside them, keeps them within it), so that range bounds them: it's widened to whole periods either side of 0, plus one below (the bias, which also covers the float rounding just past the range).
+static void setUpTexelCoords(struct DestImageGenInfo &info, const int requestedFractionBits, const TexelWrapDivisor wrapDivisor)
+{
+	int fractionBits = requestedFractionBits;
+	bool coordsFitInt = true;
+	int biasPeriodCounts[2];
+	for (int axisI = 0; axisI < 2; ++axisI) {
+		float uvMin = info.pointUVs[0].v[axisI], uvMax = uvMin;
+		for (int pointI = 1; pointI < 4; ++pointI) {
+			uvMin = fminf(uvMin, info.pointUVs[pointI].v[axisI]);
+			uvMax = fmaxf(uvMax, info.pointUVs[pointI].v[axisI]);
+		}
+		const float biasPeriodCount = fmaxf(-floorf(uvMin), 0.0f) + 1.0f;
+		const float periodCount = biasPeriodCount + fmaxf(ceilf(uvMax), 0.0f);
+		
+		const double coordMagnitude = (double)periodCount * info.srcSize_v2.v[axisI];
+		coordsFitInt = coordsFitInt && (coordMagnitude <= ldexp(1.0, kFixedPointTexelCoordBits));
+		while (fractionBits > 0 && ldexp(coordMagnitude, fractionBits) > ldexp(1.0, kFixedPointTexelCoordBits))
+			--fractionBits;
+		biasPeriodCounts[axisI] = coordsFitInt ? (int)biasPeriodCount : 0;
+	}
+	
+	info.texelFractionBits = (requestedFractionBits != 0 && fractionBits >= kMinFixedPointFractionBits) ? fractionBits : 0;
+	info.texelCoordsWrapAsInts = (info.texelFractionBits != 0) || (
+		coordsFitInt &&
+		(wrapDivisor == TexelWrapDivisorPowerOfTwo || (info.srcWidth_i >= 2 && info.srcHeight_i >= 2))
+	);
+	if (!info.texelCoordsWrapAsInts)
+		return;
+	
+	for (int axisI = 0; axisI < 2; ++axisI) {
+		const int srcSize = (axisI == 0) ? info.srcWidth_i : info.srcHeight_i;
+		info.texelWrapPeriods[axisI] = texelWrapPeriod(srcSize << info.texelFractionBits, biasPeriodCounts[axisI]);
+		info.fixedPointTexelScale.v[axisI] = ldexpf(srcSize, info.texelFractionBits);
+	}
+}
+
+/// @return: The src texel index along axis `axisI` containing `texelST`, found in fixed-point (truncated from the scaled float, so within 2^-texelFractionBits texels of it) and wrapped or clamped with integer ops.
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor>
+inline int fixedPointTexelIndex(const struct DestImageGenInfo &info, const float texelST, const int axisI)
+{
+	const int texelCoord = (int)(texelST * info.fixedPointTexelScale.v[axisI]);
+	if (tSTMode == OutsideOfTextureSTWrap) {
+		const struct TexelWrapPeriod &wrapPeriod = info.texelWrapPeriods[axisI];
+		return wrapTexelCoord<tWrapDivisor>(texelCoord + wrapPeriod.bias, wrapPeriod) >> info.texelFractionBits;
+	}
+	return clamp_i(texelCoord >> info.texelFractionBits, 0, (axisI == 0 ? info.srcWidth_i : info.srcHeight_i) - 1);
+}
+
+/// sampleTexelBytes() with fixed-point texel coords (see fixedPointTexelIndex()).
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+inline void sampleTexelBytesFixedPoint(const struct DestImageGenInfo &info, const GLKVector2 texelST, UInt8 *pixelByteBuffer)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	const int nearestTexelX = fixedPointTexelIndex<tSTMode, tWrapDivisor>(info, texelST.x, 0),
+		nearestTexelY = fixedPointTexelIndex<tSTMode, tWrapDivisor>(info, texelST.y, 1);
+	copyBytesToPixelFromTexel<tComponentCount>(pixelByteBuffer, &info.srcBytes[texelIndex<tLayout>(info, nearestTexelX, nearestTexelY) * kBytesPerPixel]);
+}
+
+/// @return: `dividend` modulo `divisor` (a wrap period), within [0, divisor), for dividends too big to bias into wrapTexelCoord()'s range.
+template<TexelWrapDivisor tWrapDivisor>
+inline int64_t fixedPointTexelModulo(const int64_t dividend, const int divisor)
+{
+	if (tWrapDivisor == TexelWrapDivisorPowerOfTwo)
+		return dividend & (divisor - 1);
+	const int64_t remainder = dividend % divisor;
+	return (remainder < 0) ? remainder + divisor : remainder;
+}
+
+/// Steps a fixed-point texel coord along an affine span (see genDestSpanBytes_affineFixedPoint()).
+/// 	Wrapping, the coord & `delta` are both within [0, `period`), so it wraps with a mask (for power-of-two periods) or a compare & subtract; clamping, it's left to wrap around as an unsigned int (the coords the span samples being in range, those come out the same as they would without overflow).
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor>
+inline uint32_t stepFixedPointTexelCoord(const uint32_t coord, const uint32_t delta, const int period)
+{
+	const uint32_t steppedCoord = coord + delta;
+	if (tSTMode != OutsideOfTextureSTWrap)
+		return steppedCoord;
+	if (tWrapDivisor == TexelWrapDivisorPowerOfTwo)
+		return steppedCoord & (period - 1);
+	return (steppedCoord >= (uint32_t)period) ? steppedCoord - period : steppedCoord;
+}
+
+/// @return: The src texel index of a fixed-point texel coord stepped by stepFixedPointTexelCoord().
+template<OutsideOfTextureSTMode tSTMode>
+inline int affineFixedPointTexelIndex(const uint32_t coord, const int fractionBits, const int srcMaxIndex)
+{
+	if (tSTMode == OutsideOfTextureSTWrap)
+		return coord >> fractionBits;
+	return clamp_i((int32_t)coord >> fractionBits, 0, srcMaxIndex);
+}
+
+/// Where a coord falls along one axis, as the filtered samples take it: the texel whose center it's at or past, and how far past.
+struct TexelCenterOffset {
+	/// Wrapped into the src for OutsideOfTextureSTWrap; not yet clamped for OutsideOfTextureSTClamp (so it's from -1 to the src's last texel, or beyond with fixed-point coords).
+	int lowerIndex;
+	/// Within [0, kBilinearWeightOne]: how far the coord is past the lower texel's center, towards the next one's (rounded to nearest, so a coord a rounding error either side of a texel's center takes just that texel).
+	int upperWeight;
+};
+
+/// @return: Where `texelST` falls along axis `axisI` (see TexelCenterOffset), with float or fixed-point coords as `info` was set up for.
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor>
+inline struct TexelCenterOffset texelCenterOffset(const struct DestImageGenInfo &info, float texelST, const int axisI)
+{
+	const int srcSize = (axisI == 0) ? info.srcWidth_i : info.srcHeight_i;
+	struct TexelCenterOffset offset;
+	if (info.texelFractionBits != 0) {
+		// (measured from the texel centers, so the lower texel is the integer part, and the weight the fraction rounded to kBilinearWeightBits— the same before & after wrapping, which drops whole periods)
+		int texelCoord = (int)(texelST * info.fixedPointTexelScale.v[axisI]) - (1 << (info.texelFractionBits - 1));
+		const int weightShift = info.texelFractionBits - kBilinearWeightBits;
+		offset.upperWeight = ((texelCoord & ((1 << info.texelFractionBits) - 1)) + ((1 << weightShift) >> 1)) >> weightShift;
+		if (tSTMode == OutsideOfTextureSTWrap)
+			texelCoord = wrapTexelCoord<tWrapDivisor>(texelCoord + info.texelWrapPeriods[axisI].bias, info.texelWrapPeriods[axisI]);
+		offset.lowerIndex = texelCoord >> info.texelFractionBits;
+	}
+	else {
+		const bool wrapsAsInts = (tSTMode == OutsideOfTextureSTWrap && info.texelCoordsWrapAsInts);
+		if (!wrapsAsInts)
+			normalizeTexelSTCoord<tSTMode>(texelST);
+		
+		const float texelCoord = texelST * info.srcSize_v2.v[axisI] - 0.5f;
+		offset.lowerIndex = nearestTexelIndex(texelCoord);
+		offset.upperWeight = (int)((texelCoord - offset.lowerIndex) * kBilinearWeightOne + 0.5f);
+		if (wrapsAsInts)
+			offset.lowerIndex = wrapTexelCoord<tWrapDivisor>(offset.lowerIndex + info.texelWrapPeriods[axisI].bias, info.texelWrapPeriods[axisI]);
+		else if (tSTMode == OutsideOfTextureSTWrap && offset.lowerIndex < 0) // (the ST being normalized, that's only within the half texel before the first one's center)
+			offset.lowerIndex += srcSize;
+	}
+	return offset;
+}
+
+/// The two texels along one axis that a bilinear sample blends, and how much of the upper one it takes.
+struct BilinearTexelPair {
+	int lowerIndex, upperIndex;
+	/// As TexelCenterOffset's.
+	int upperWeight;
+};
+
+/// @return: The texels along axis `axisI` whose centers are either side of `texelST` (see texelCenterOffset()), wrapped or clamped per `tSTMode` (the upper one past the src's last texel wrapping to its first, or clamping to the last).
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor>
+inline struct BilinearTexelPair bilinearTexelPair(const struct DestImageGenInfo &info, float texelST, const int axisI)
+{
+	const int srcSize = (axisI == 0) ? info.srcWidth_i : info.srcHeight_i;
+	const struct TexelCenterOffset offset = texelCenterOffset<tSTMode, tWrapDivisor>(info, texelST, axisI);
+	struct BilinearTexelPair pair;
+	pair.upperWeight = offset.upperWeight;
+	if (tSTMode == OutsideOfTextureSTWrap) {
+		pair.lowerIndex = offset.lowerIndex;
+		pair.upperIndex = (offset.lowerIndex + 1 < srcSize) ? offset.lowerIndex + 1 : 0;
+	}
+	else {
+		pair.lowerIndex = clamp_i(offset.lowerIndex, 0, srcSize - 1);
+		pair.upperIndex = clamp_i(offset.lowerIndex + 1, 0, srcSize - 1);
+	}
+	return pair;
+}
+
+/// @return: The 8-bit channel values `lower` & `upper` blended, `upperWeight` being out of kBilinearWeightOne; rounded to nearest.
+static inline int lerpChannel(const int lower, const int upper, const int upperWeight)
+{
+	return (lower * (kBilinearWeightOne - upperWeight) + upper * upperWeight + kBilinearWeightOne / 2) >> kBilinearWeightBits;
+}
+
+/// Blends the 2×2 texels of `pairX` & `pairY` into the pixel at `pixelBytes`: along x within each row, then between the rows (rounding each time, as the SIMD kernels do).
+template<TexelLayout tLayout, int tComponentCount>
+inline void blendBilinearTexels(const struct DestImageGenInfo &info, const struct BilinearTexelPair &pairX, const struct BilinearTexelPair &pairY, UInt8 *pixelBytes)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	const UInt8 *lowerRowBytes = &info.srcBytes[texelAxisIndex<tLayout>(info, pairY.lowerIndex, 1) * kBytesPerPixel],
+		*upperRowBytes = &info.srcBytes[texelAxisIndex<tLayout>(info, pairY.upperIndex, 1) * kBytesPerPixel];
+	const size_t lowerXByteOffset = texelAxisIndex<tLayout>(info, pairX.lowerIndex, 0) * kBytesPerPixel, upperXByteOffset = texelAxisIndex<tLayout>(info, pairX.upperIndex, 0) * kBytesPerPixel;
+	for (int componentI = 0; componentI < tComponentCount; ++componentI) {
+		const int lowerRowValue = lerpChannel(lowerRowBytes[lowerXByteOffset + componentI], lowerRowBytes[upperXByteOffset + componentI], pairX.upperWeight),
+			upperRowValue = lerpChannel(upperRowBytes[lowerXByteOffset + componentI], upperRowBytes[upperXByteOffset + componentI], pairX.upperWeight);
+		pixelBytes[componentI] = (UInt8)lerpChannel(lowerRowValue, upperRowValue, pairY.upperWeight);
+	}
+}
+
+/// Bilinear-filtered sample of the src image at `texelST` (see bilinearTexelPair()).
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+inline void sampleTexelBytesBilinear(const struct DestImageGenInfo &info, const GLKVector2 texelST, UInt8 *pixelByteBuffer)
+{
+	blendBilinearTexels<tLayout, tComponentCount>(info,
+		bilinearTexelPair<tSTMode, tWrapDivisor>(info, texelST.x, 0), bilinearTexelPair<tSTMode, tWrapDivisor>(info, texelST.y, 1),
+		pixelByteBuffer
+	);
+}
+
+/// @return: How many texels along each axis a separable resampling filter mode (see filterModeResamples()) takes.
+static constexpr int resamplingTapCount(const TextureFilterMode filterMode)
+{
+	return (filterMode == TextureFilterLanczos3) ? 6 : 4;
+}
+
+/// The texels along one axis that a separable resampling filter weighs, and its weight for each.
+template<int tTapCount>
+struct ResamplingTaps {
+	/// Wrapped or clamped into the src; the first being `tTapCount / 2 - 1` texels before the coord's lower texel.
+	int indices[tTapCount];
+	/// A row of `info.resamplingWeights`: the one for the coord's phase.
+	const int *weights;
+};
+
+/// @return: The `tTapCount` texels along axis `axisI` around `texelST` (see texelCenterOffset()), wrapped or clamped per `tSTMode` each, and the filter's weights for them.
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor, int tTapCount>
+inline struct ResamplingTaps<tTapCount> resamplingTaps(const struct DestImageGenInfo &info, const float texelST, const int axisI)
+{
+	static const int kFirstTapOffset = 1 - tTapCount / 2;
+	
+	const int srcSize = (axisI == 0) ? info.srcWidth_i : info.srcHeight_i;
+	const struct TexelCenterOffset offset = texelCenterOffset<tSTMode, tWrapDivisor>(info, texelST, axisI);
+	struct ResamplingTaps<tTapCount> taps;
+	taps.weights = info.resamplingWeights->weights[offset.upperWeight];
+	for (int tapI = 0; tapI < tTapCount; ++tapI) {
+		const int texelI = offset.lowerIndex + kFirstTapOffset + tapI;
+		if (tSTMode == OutsideOfTextureSTWrap) {
+			// (the lower texel being within the src, the taps are at most a period out of it— unless the src is narrower than the filter)
+			if (srcSize >= tTapCount)
+				taps.indices[tapI] = (texelI < 0) ? texelI + srcSize : (texelI >= srcSize) ? texelI - srcSize : texelI;
+			else
+				taps.indices[tapI] = modulo_i(texelI, srcSize);
+		}
+		else
+			taps.indices[tapI] = clamp_i(texelI, 0, srcSize - 1);
+	}
+	return taps;
+}
+
+/// @return: A sum of channel values times resampling weights, back down to the channel's scale (rounded to nearest; and not clamped, so the second pass over the first's sums keeps their overshoot).
+static inline int resampledChannel(const int weightedSum)
+{
+	return (weightedSum + (1 << (kResamplingWeightBits - 1))) >> kResamplingWeightBits;
+}
+
+/// Resamples the `tTapCount`×`tTapCount` texels of `tapsX` & `tapsY` into the pixel at `pixelBytes`: along x within each row, then across the rows (rounding each time, as the SIMD kernels do), clamping the result to a channel's range.
+template<int tTapCount, int tComponentCount>
+inline void blendResamplingTexels(const struct DestImageGenInfo &info, const struct ResamplingTaps<tTapCount> &tapsX, const struct ResamplingTaps<tTapCount> &tapsY, UInt8 *pixelBytes)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	const size_t srcBytesPerRow = (size_t)info.srcWidth_i * kBytesPerPixel;
+	int componentSums[tComponentCount] = {};
+	for (int tapY = 0; tapY < tTapCount; ++tapY) {
+		const UInt8 *rowBytes = &info.srcBytes[tapsY.indices[tapY] * srcBytesPerRow];
+		int rowSums[tComponentCount] = {};
+		for (int tapX = 0; tapX < tTapCount; ++tapX) {
+			const UInt8 *texelBytes = &rowBytes[tapsX.indices[tapX] * kBytesPerPixel];
+			for (int componentI = 0; componentI < tComponentCount; ++componentI)
+				rowSums[componentI] += texelBytes[componentI] * tapsX.weights[tapX];
+		}
+		for (int componentI = 0; componentI < tComponentCount; ++componentI)
+			componentSums[componentI] += resampledChannel(rowSums[componentI]) * tapsY.weights[tapY];
+	}
+	for (int componentI = 0; componentI < tComponentCount; ++componentI)
+		pixelBytes[componentI] = (UInt8)clamp_i(resampledChannel(componentSums[componentI]), 0, UINT8_MAX);
+}
+
+/// Bicubic- or Lanczos-filtered sample of the src image at `texelST` (see resamplingTaps()).
+template<OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, int tComponentCount>
+inline void sampleTexelBytesResampled(const struct DestImageGenInfo &info, const GLKVector2 texelST, UInt8 *pixelByteBuffer)
+{
+	static const int kTapCount = resamplingTapCount(tFilterMode);
+	blendResamplingTexels<kTapCount, tComponentCount>(info,
+		resamplingTaps<tSTMode, tWrapDivisor, kTapCount>(info, texelST.x, 0), resamplingTaps<tSTMode, tWrapDivisor, kTapCount>(info, texelST.y, 1),
+		pixelByteBuffer
+	);
+}
+
+/// The change in unnormalizedTexelUV() over a dest pixel along each dest axis: the mapping's Jacobian, in UV per pixel.
+struct UVJacobian {
+	GLKVector2 uvPerPixelX, uvPerPixelY;
+};
+
+/// @return: Whether the Jacobian at `surfaceST` could be found, into `out_jacobian`: from the UV a pixel forwards along each axis, or backwards where there's none forwards; not so next to where the mapping has no UVs.
+template<QuadMappingMode tMappingMode>
+bool uvJacobianAtSurfaceST(const struct DestImageGenInfo &info, const GLKVector2 surfaceST, struct UVJacobian *out_jacobian)
+{
+	const GLKVector2 uv = unnormalizedTexelUV<tMappingMode>(info, surfaceST);
+	if (GLKVector2IsInvalid(uv))
+		return false;
+	
+	GLKVector2 *uvPerPixel[2] = { &out_jacobian->uvPerPixelX, &out_jacobian->uvPerPixelY };
+	for (int axisI = 0; axisI < 2; ++axisI) {
+		const GLKVector2 pixelDelta = GLKVector2Make(axisI == 0 ? info.destSizeReciprocal_v2.x : 0.0f, axisI == 1 ? info.destSizeReciprocal_v2.y : 0.0f);
+		
+		GLKVector2 uvDelta = GLKVector2Subtract(unnormalizedTexelUV<tMappingMode>(info, GLKVector2Add(surfaceST, pixelDelta)), uv);
+		if (GLKVector2IsInvalid(uvDelta))
+			uvDelta = GLKVector2Subtract(uv, unnormalizedTexelUV<tMappingMode>(info, GLKVector2Subtract(surfaceST, pixelDelta)));
+		if (GLKVector2IsInvalid(uvDelta))
+			return false;
+		*uvPerPixel[axisI] = uvDelta;
+	}
+	return true;
+}
+
+/// @return: The square of how many src texels (of a src `srcSize` texels in size) a dest pixel spans, along whichever dest axis spans more.
+static inline float uvJacobianTexelsPerPixelSqr(const struct UVJacobian &uvJacobian, const GLKVector2 srcSize)
+{
+	return fmaxf(
+		GLKVector2LengthSqr(GLKVector2Multiply(uvJacobian.uvPerPixelX, srcSize)),
+		GLKVector2LengthSqr(GLKVector2Multiply(uvJacobian.uvPerPixelY, srcSize))
+	);
+}
+
+/// @return: The mip level of detail at `surfaceST`: log2 of how many src texels a dest pixel spans there, along whichever dest axis spans more (from uvJacobianAtSurfaceST()), clamped to the mip chain's levels.  Where the Jacobian can't be found, it takes the last level.
+template<QuadMappingMode tMappingMode>
+float mipLODAtSurfaceST(const struct DestImageGenInfo &info, const GLKVector2 surfaceST)
+{
+	const float maxLOD = info.mipLevelCount - 1;
+	
+	struct UVJacobian jacobian;
+	if (!uvJacobianAtSurfaceST<tMappingMode>(info, surfaceST, &jacobian))
+		return maxLOD;
+	
+	const float texelsPerPixelSqr = uvJacobianTexelsPerPixelSqr(jacobian, info.srcSize_v2);
+	// (half the log2 of the square; magnification, a UV that doesn't change (-∞), and degenerate quads (NaN) all come out level 0)
+	return fminf(fmaxf(0.5f * log2f(texelsPerPixelSqr), 0.0f), maxLOD);
+}
+
+/// @return: uvJacobianAtSurfaceST() as EWA & summed-area filtering take it: each UV change clamped to within [-1, 1] (a pixel spanning more than the whole src along an axis coming out no blurrier for it, and the footprint ellipse's terms staying well within a float's range), and a pixel spanning the whole src along each axis where the Jacobian can't be found.
+template<QuadMappingMode tMappingMode>
+struct UVJacobian footprintUVJacobianAtSurfaceST(const struct DestImageGenInfo &info, const GLKVector2 surfaceST)
+{
+	struct UVJacobian jacobian;
+	if (!uvJacobianAtSurfaceST<tMappingMode>(info, surfaceST, &jacobian))
+		return (struct UVJacobian){ GLKVector2Make(1.0f, 0.0f), GLKVector2Make(0.0f, 1.0f) };
+	
+	const GLKVector2 minUVPerPixel = GLKVector2Make(-1.0f, -1.0f), maxUVPerPixel = GLKVector2Make(1.0f, 1.0f);
+	jacobian.uvPerPixelX = GLKVector2Minimum(GLKVector2Maximum(jacobian.uvPerPixelX, minUVPerPixel), maxUVPerPixel);
+	jacobian.uvPerPixelY = GLKVector2Minimum(GLKVector2Maximum(jacobian.uvPerPixelY, minUVPerPixel), maxUVPerPixel);
+	return jacobian;
+}
+
+/// @return: The size of the rectangle bounding a pixel's footprint (with the UV Jacobian `uvJacobian`) in a src `srcSize` texels in size, in texels.
+static inline GLKVector2 footprintBoundingTexelSize(const struct UVJacobian &uvJacobian, const GLKVector2 srcSize)
+{
+	return GLKVector2Multiply(GLKVector2Make(
+		fabsf(uvJacobian.uvPerPixelX.x) + fabsf(uvJacobian.uvPerPixelY.x),
+		fabsf(uvJacobian.uvPerPixelX.y) + fabsf(uvJacobian.uvPerPixelY.y)
+	), srcSize);
+}
+
+/// How far within the magnification thresholds each of a footprint grid row's points must be for footprintMagnifies() to hold for every pixel around them too, the Jacobians interpolated between the points rounding a little past them.
+static const float kFootprintGridMagnificationMargin = 1.0f - 1.0f / 1024;
+
+/// @return: Whether a pixel with the footprint `uvJacobian` magnifies the src, so TextureFilterEWA or TextureFilterSummedArea just take its bilinear sample: for EWA, its spanning no more than a texel along either dest axis (as trilinear's level 0 does); for summed-area, its bounding rectangle being under 1.5 texels along both src axes.  The thresholds are scaled by `thresholdScale`.  NaN footprints, from degenerate quads, magnify.
+template<TextureFilterMode tFilterMode>
+static inline bool footprintMagnifies(const struct UVJacobian &uvJacobian, const GLKVector2 srcSize, const float thresholdScale)
+{
+	if (tFilterMode == TextureFilterEWA)
+		return !(uvJacobianTexelsPerPixelSqr(uvJacobian, srcSize) > thresholdScale * thresholdScale);
+	
+	const GLKVector2 footprint = footprintBoundingTexelSize(uvJacobian, srcSize);
+	return !(footprint.x >= 1.5f * thresholdScale || footprint.y >= 1.5f * thresholdScale);
+}
+
+/// The footprint grid for the TileWorkerPool to fill, a grid row per tile: `lods` for TextureFilterTrilinear, or `uvJacobians` for TextureFilterEWA & TextureFilterSummedArea; and `magnifiedRows` for all of them.
+struct FootprintGridSetup {
+	const struct DestImageGenInfo *info;
+	float *lods;
+	struct UVJacobian *uvJacobians;
+	bool *magnifiedRows;
+};
+
+/// TileWork callback; `context` is a FootprintGridSetup.
+template<QuadMappingMode tMappingMode, TextureFilterMode tFilterMode>
+void setUpFootprintGridRow(void *context, int gridY)
+{
+	const struct FootprintGridSetup &setup = *(const struct FootprintGridSetup *)context;
+	const struct DestImageGenInfo &info = *setup.info;
+	
+	const float surfaceT = (gridY * kFootprintGridSpacing) * info.destSizeReciprocal_v2.y;
+	const int rowGridI = gridY * info.footprintGridWidth;
+	bool rowMagnifies = true;
+	for (int gridX = 0; gridX < info.footprintGridWidth; ++gridX) {
+		const GLKVector2 surfaceST = GLKVector2Make((gridX * kFootprintGridSpacing) * info.destSizeReciprocal_v2.x, surfaceT);
+		if (tFilterMode == TextureFilterTrilinear) {
+			const float lod = mipLODAtSurfaceST<tMappingMode>(info, surfaceST);
+			setup.lods[rowGridI + gridX] = lod;
+			// (level 0s interpolating to exactly level 0)
+			rowMagnifies = rowMagnifies && (lod == 0.0f);
+		}
+		else {
+			const struct UVJacobian jacobian = footprintUVJacobianAtSurfaceST<tMappingMode>(info, surfaceST);
+			setup.uvJacobians[rowGridI + gridX] = jacobian;
+			rowMagnifies = rowMagnifies && footprintMagnifies<tFilterMode>(jacobian, info.srcSize_v2, kFootprintGridMagnificationMargin);
+		}
+	}
+	setup.magnifiedRows[gridY] = rowMagnifies;
+}
+
+/// Sets up `info.mipLevelInfos` from `mipChain` (each level's texel coords per `requestedFractionBits` & `wrapDivisor`, as the src's are; a power-of-two src's levels all being powers of two too), to be freed by freeMipLevels().
+static void setUpMipLevels(struct DestImageGenInfo &info, const struct CGTextureMappingMipChain &mipChain, const int requestedFractionBits, const TexelWrapDivisor wrapDivisor)
+{
+	struct DestImageGenInfo *levelInfos = (struct DestImageGenInfo *)malloc(mipChain.levelCount * sizeof(struct DestImageGenInfo));
+	for (int levelI = 0; levelI < mipChain.levelCount; ++levelI) {
+		struct DestImageGenInfo &levelInfo = levelInfos[levelI];
+		levelInfo = info;
+		levelInfo.srcWidth_i = mipChain.levelWidths[levelI];
+		levelInfo.srcHeight_i = mipChain.levelHeights[levelI];
+		levelInfo.srcSize_v2 = GLKVector2Make(levelInfo.srcWidth_i, levelInfo.srcHeight_i);
+		levelInfo.srcBytes = mipChain.levelBytes[levelI];
+		levelInfo.srcTexelIndicesFitInt = ((size_t)levelInfo.srcWidth_i * levelInfo.srcHeight_i <= INT_MAX);
+		setUpTexelCoords(levelInfo, requestedFractionBits, wrapDivisor);
+	}
+	info.mipLevelInfos = levelInfos;
+	info.mipLevelCount = mipChain.levelCount;
+}
+
+static void freeMipLevels(struct DestImageGenInfo &info)
+{
+	free((void *)info.mipLevelInfos);
+}
+
+/// Fills the filter mode's footprint grid across `threadCount` threads (after setUpMipLevels(), for the modes that sample a mip chain), to be freed by freeFootprintGrid().
+template<QuadMappingMode tMappingMode, TextureFilterMode tFilterMode>
+void setUpFootprintGrid(struct DestImageGenInfo &info, const int threadCount)
+{
+	info.footprintGridWidth = (info.destWidth_i - 1) / kFootprintGridSpacing + 2;
+	const int gridHeight = (info.destHeight_i - 1) / kFootprintGridSpacing + 2;
+	const size_t gridPointCount = (size_t)info.footprintGridWidth * gridHeight;
+	struct FootprintGridSetup gridSetup = {
+		&info,
+		(tFilterMode == TextureFilterTrilinear) ? (float *)malloc(gridPointCount * sizeof(float)) : NULL,
+		(tFilterMode == TextureFilterTrilinear) ? NULL : (struct UVJacobian *)malloc(gridPointCount * sizeof(struct UVJacobian)),
+		(bool *)malloc(gridHeight * sizeof(bool)),
+	};
+	tileWorkerPoolRun(gridHeight, threadCount, setUpFootprintGridRow<tMappingMode, tFilterMode>, &gridSetup);
+	info.mipLODGrid = gridSetup.lods;
+	info.uvJacobianGrid = gridSetup.uvJacobians;
+	info.magnifiedFootprintGridRows = gridSetup.magnifiedRows;
+}
+
+static void freeFootprintGrid(struct DestImageGenInfo &info)
+{
+	free((void *)info.mipLODGrid);
+	free((void *)info.uvJacobianGrid);
+	free((void *)info.magnifiedFootprintGridRows);
+}
+
+/// @return: Whether every pixel in the dest rows `[startY, endY)` magnifies the src, from the footprint grid rows around them (see `magnifiedFootprintGridRows`).
+static inline bool destRowRangeMagnifies(const struct DestImageGenInfo &info, const int startY, const int endY)
+{
+	const int startGridY = startY / kFootprintGridSpacing,
+		endGridY = (endY - 1) / kFootprintGridSpacing + 1;
+	for (int gridY = startGridY; gridY <= endGridY; ++gridY) {
+		if (!info.magnifiedFootprintGridRows[gridY])
+			return false;
+	}
+	return true;
+}
+
+/// @return: Whether every pixel in `[startPixelI, endPixelI)` magnifies the src, from the footprint grid rows around their rows.
+static inline bool destPixelRangeMagnifies(const struct DestImageGenInfo &info, const int startPixelI, const int endPixelI)
+{
+	return destRowRangeMagnifies(info, startPixelI / info.destWidth_i, (endPixelI - 1) / info.destWidth_i + 1);
+}
+
+/// Where a dest pixel falls within the footprint grid: the index of the grid point up & left of it, and how far it is towards the next one along each axis.
+struct FootprintGridCell {
+	int gridI;
+	float xRatio, yRatio;
+};
+
+static inline struct FootprintGridCell footprintGridCell(const struct DestImageGenInfo &info, const int pixelX, const int pixelY)
+{
+	static const float kGridSpacingReciprocal = 1.0f / kFootprintGridSpacing;
+	
+	struct FootprintGridCell cell;
+	cell.gridI = (pixelY / kFootprintGridSpacing) * info.footprintGridWidth + pixelX / kFootprintGridSpacing;
+	cell.xRatio = (pixelX % kFootprintGridSpacing) * kGridSpacingReciprocal;
+	cell.yRatio = (pixelY % kFootprintGridSpacing) * kGridSpacingReciprocal;
+	return cell;
+}
+
+/// @return: The level of detail at a dest pixel, interpolated bilinearly between the 2×2 of `info.mipLODGrid` around it.
+static inline float mipLODAtPixel(const struct DestImageGenInfo &info, const int pixelX, const int pixelY)
+{
+	const struct FootprintGridCell cell = footprintGridCell(info, pixelX, pixelY);
+	const float *lods = &info.mipLODGrid[cell.gridI],
+		*nextRowLODs = &lods[info.footprintGridWidth];
+	const float rowLOD = lods[0] + (lods[1] - lods[0]) * cell.xRatio,
+		nextRowLOD = nextRowLODs[0] + (nextRowLODs[1] - nextRowLODs[0]) * cell.xRatio;
+	// (clamped again, in case the lerps rounded past the last level)
+	return fminf(rowLOD + (nextRowLOD - rowLOD) * cell.yRatio, info.mipLevelCount - 1);
+}
+
+/// @return: The UV Jacobian at a dest pixel, interpolated bilinearly between the 2×2 of `info.uvJacobianGrid` around it.
+static inline struct UVJacobian uvJacobianAtPixel(const struct DestImageGenInfo &info, const int pixelX, const int pixelY)
+{
+	const struct FootprintGridCell cell = footprintGridCell(info, pixelX, pixelY);
+	const struct UVJacobian *jacobians = &info.uvJacobianGrid[cell.gridI],
+		*nextRowJacobians = &jacobians[info.footprintGridWidth];
+	struct UVJacobian jacobian;
+	jacobian.uvPerPixelX = GLKVector2Lerp(
+		GLKVector2Lerp(jacobians[0].uvPerPixelX, jacobians[1].uvPerPixelX, cell.xRatio),
+		GLKVector2Lerp(nextRowJacobians[0].uvPerPixelX, nextRowJacobians[1].uvPerPixelX, cell.xRatio),
+		cell.yRatio
+	);
+	jacobian.uvPerPixelY = GLKVector2Lerp(
+		GLKVector2Lerp(jacobians[0].uvPerPixelY, jacobians[1].uvPerPixelY, cell.xRatio),
+		GLKVector2Lerp(nextRowJacobians[0].uvPerPixelY, nextRowJacobians[1].uvPerPixelY, cell.xRatio),
+		cell.yRatio
+	);
+	return jacobian;
+}
+
+/// The two mip levels a trilinear sample blends, and how much of the upper (smaller) one it takes.
+struct MipLevelBlend {
+	int lowerLevel;
+	/// Within [0, kBilinearWeightOne): how far the level of detail is past the lower level, towards the upper (rounded to nearest, a level of detail that rounds up to the next level taking just that one).
+	int upperWeight;
+};
+
+/// @arg lod: Within [0, the last mip level].
+static inline struct MipLevelBlend mipLevelBlend(const float lod)
+{
+	struct MipLevelBlend blend;
+	blend.lowerLevel = (int)lod;
+	blend.upperWeight = (int)((lod - blend.lowerLevel) * kBilinearWeightOne + 0.5f);
+	if (blend.upperWeight == kBilinearWeightOne) {
+		++blend.lowerLevel;
+		blend.upperWeight = 0;
+	}
+	return blend;
+}
+
+/// Trilinear-filtered sample of the mip chain at `texelST`: bilinear samples (see sampleTexelBytesBilinear()) of `levelBlend`'s two levels, blended per channel as the bilinear samples blend their texels— or just the lower level's, if it takes none of the upper.
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor, int tComponentCount>
+inline void sampleTexelBytesTrilinear(const struct DestImageGenInfo &info, const GLKVector2 texelST, const struct MipLevelBlend &levelBlend, UInt8 *pixelByteBuffer)
+{
+	const struct DestImageGenInfo &lowerLevelInfo = info.mipLevelInfos[levelBlend.lowerLevel];
+	if (levelBlend.upperWeight == 0) {
+		sampleTexelBytesBilinear<tSTMode, tWrapDivisor, TexelLayoutLinear, tComponentCount>(lowerLevelInfo, texelST, pixelByteBuffer);
+		return;
+	}
+	
+	UInt8 lowerLevelBytes[tComponentCount], upperLevelBytes[tComponentCount];
+	sampleTexelBytesBilinear<tSTMode, tWrapDivisor, TexelLayoutLinear, tComponentCount>(lowerLevelInfo, texelST, lowerLevelBytes);
+	sampleTexelBytesBilinear<tSTMode, tWrapDivisor, TexelLayoutLinear, tComponentCount>(info.mipLevelInfos[levelBlend.lowerLevel + 1], texelST, upperLevelBytes);
+	for (int componentI = 0; componentI < tComponentCount; ++componentI)
+		pixelByteBuffer[componentI] = (UInt8)lerpChannel(lowerLevelBytes[componentI], upperLevelBytes[componentI], levelBlend.upperWeight);
+}
+
+/// A pixel's footprint within a mip level, as EWA filtering weighs it: the ellipse of texels (at `x`, `y` texels from the footprint's center) where `a*x² + b*x*y + c*y² < 1`.
+struct EWAEllipse {
+	float a, b, c;
+};
+
+/// @return: Heckbert's footprint ellipse for `uvJacobian` at a mip level `levelSize` texels in size: the ellipse the pixel maps to, widened by a texel along each of its axes (so it's never narrower than the texel grid, which'd drop texels between its taps), and scaled for its quadratic form to be 1 at its edge.
+static inline struct EWAEllipse ewaEllipse(const struct UVJacobian &uvJacobian, const GLKVector2 levelSize)
+{
+	const GLKVector2 texelsPerPixelX = GLKVector2Multiply(uvJacobian.uvPerPixelX, levelSize),
+		texelsPerPixelY = GLKVector2Multiply(uvJacobian.uvPerPixelY, levelSize);
+	
+	const float a = texelsPerPixelX.y * texelsPerPixelX.y + texelsPerPixelY.y * texelsPerPixelY.y + 1.0f,
+		b = -2.0f * (texelsPerPixelX.x * texelsPerPixelX.y + texelsPerPixelY.x * texelsPerPixelY.y),
+		c = texelsPerPixelX.x * texelsPerPixelX.x + texelsPerPixelY.x * texelsPerPixelY.x + 1.0f;
+	// (at least 1, from the widening)
+	const float scaleReciprocal = 1.0f / (a * c - 0.25f * b * b);
+	struct EWAEllipse ellipse = { a * scaleReciprocal, b * scaleReciprocal, c * scaleReciprocal };
+	return ellipse;
+}
+
+/// @return: How far ewaEllipse() reaches from its center along each axis, in texels: the square roots of its `c` & `a` before they're scaled (which no level search needs to divide for).
+static inline GLKVector2 ewaEllipseRadius(const struct UVJacobian &uvJacobian, const GLKVector2 levelSize)
+{
+	const GLKVector2 texelsPerPixelX = GLKVector2Multiply(uvJacobian.uvPerPixelX, levelSize),
+		texelsPerPixelY = GLKVector2Multiply(uvJacobian.uvPerPixelY, levelSize);
+	return GLKVector2Make(
+		sqrtf(texelsPerPixelX.x * texelsPerPixelX.x + texelsPerPixelY.x * texelsPerPixelY.x + 1.0f),
+		sqrtf(texelsPerPixelX.y * texelsPerPixelX.y + texelsPerPixelY.y * texelsPerPixelY.y + 1.0f)
+	);
+}
+
+/// Fills `out_texelIndices` with the texels from `startTexelI` up to `endTexelI`, wrapped or clamped into a src side `srcSize` texels long (wrapped by stepping from the first, so with just the one division).
+template<OutsideOfTextureSTMode tSTMode>
+static inline void ewaTexelIndices(const int startTexelI, const int endTexelI, const int srcSize, int *out_texelIndices)
+{
+	int wrappedTexelI = (tSTMode == OutsideOfTextureSTWrap) ? modulo_i(startTexelI, srcSize) : 0;
+	for (int texelI = startTexelI; texelI < endTexelI; ++texelI) {
+		if (tSTMode == OutsideOfTextureSTWrap) {
+			out_texelIndices[texelI - startTexelI] = wrappedTexelI;
+			if (++wrappedTexelI == srcSize)
+				wrappedTexelI = 0;
+		}
+		else
+			out_texelIndices[texelI - startTexelI] = clamp_i(texelI, 0, srcSize - 1);
+	}
+}
+
+/// EWA-filtered sample of the mip chain at `texelST` (see TextureFilterEWA): each texel whose center is within the footprint ellipse (see ewaEllipse()) of the finest level where its bounding box (see ewaEllipseRadius()) takes no more than `info.maxFilterTapCount` texels— or of the last level, whatever it takes, its texels being few— weighted per kEWAWeights by its distance through the ellipse, and summed per channel as ints (so the result's independent of the order they're summed in).  A magnifying footprint (see footprintMagnifies()) takes level 0's bilinear sample instead.
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor, int tComponentCount>
+void sampleTexelBytesEWA(const struct DestImageGenInfo &info, GLKVector2 texelST, const struct UVJacobian &uvJacobian, UInt8 *pixelByteBuffer)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	if (footprintMagnifies<TextureFilterEWA>(uvJacobian, info.srcSize_v2, 1.0f)) {
+		sampleTexelBytesBilinear<tSTMode, tWrapDivisor, TexelLayoutLinear, tComponentCount>(info.mipLevelInfos[0], texelST, pixelByteBuffer);
+		return;
+	}
+	
+	normalizeTexelSTCoord<tSTMode>(texelST.x);
+	normalizeTexelSTCoord<tSTMode>(texelST.y);
+	
+	// the level, & the texels (by their centers) within the ellipse's bounding box there
+	const struct DestImageGenInfo *levelInfo;
+	GLKVector2 center;
+	int startTexelX, endTexelX, startTexelY, endTexelY;
+	for (int levelI = 0; ; ++levelI) {
+		levelInfo = &info.mipLevelInfos[levelI];
+		const GLKVector2 radius = ewaEllipseRadius(uvJacobian, levelInfo->srcSize_v2);
+		center = GLKVector2Subtract(GLKVector2Multiply(texelST, levelInfo->srcSize_v2), GLKVector2Make(0.5f, 0.5f));
+		startTexelX = (int)ceilf(center.x - radius.x);
+		endTexelX = (int)floorf(center.x + radius.x) + 1;
+		startTexelY = (int)ceilf(center.y - radius.y);
+		endTexelY = (int)floorf(center.y + radius.y) + 1;
+		if ((int64_t)(endTexelX - startTexelX) * (endTexelY - startTexelY) <= info.maxFilterTapCount || levelI == info.mipLevelCount - 1)
+			break;
+	}
+	const struct EWAEllipse ellipse = ewaEllipse(uvJacobian, levelInfo->srcSize_v2);
+	const int levelWidth = levelInfo->srcWidth_i, levelHeight = levelInfo->srcHeight_i;
+	const size_t levelBytesPerRow = (size_t)levelWidth * kBytesPerPixel;
+	
+	// (the bounding box being within the tap count along each axis, bar the last level's, which spans a few texels at most)
+	int columnIndices[kMaxFilterTapCount], rowIndices[kMaxFilterTapCount];
+	ewaTexelIndices<tSTMode>(startTexelX, endTexelX, levelWidth, columnIndices);
+	ewaTexelIndices<tSTMode>(startTexelY, endTexelY, levelHeight, rowIndices);
+	
+	int componentSums[tComponentCount] = {}, weightSum = 0;
+	for (int texelY = startTexelY; texelY < endTexelY; ++texelY) {
+		const float y = texelY - center.y;
+		const float rowDistanceSqr = ellipse.c * y * y, rowXTerm = ellipse.b * y;
+		const UInt8 *rowBytes = &levelInfo->srcBytes[rowIndices[texelY - startTexelY] * levelBytesPerRow];
+		for (int texelX = startTexelX; texelX < endTexelX; ++texelX) {
+			const float x = texelX - center.x;
+			// (the taps past the ellipse's edge taking the weight after the last, of 0, rather than being branched around)
+			const float distanceSqr = (ellipse.a * x + rowXTerm) * x + rowDistanceSqr;
+			const int weight = kEWAWeights[(int)(fminf(distanceSqr, 1.0f) * kEWAWeightCount)];
+			const UInt8 *texelBytes = &rowBytes[columnIndices[texelX - startTexelX] * kBytesPerPixel];
+			for (int componentI = 0; componentI < tComponentCount; ++componentI)
+				componentSums[componentI] += texelBytes[componentI] * weight;
+			weightSum += weight;
+		}
+	}
+	// (the ellipse always takes the texel nearest its center, being at least a texel in radius)
+	for (int componentI = 0; componentI < tComponentCount; ++componentI)
+		pixelByteBuffer[componentI] = (UInt8)((componentSums[componentI] + weightSum / 2) / weightSum);
+}
+
+/// Fills `out_sums` with the per-channel sums of the src texels within [0, x) × [0, y), from `table` (so modulo 2^32, as its sums are).  When wrapping, the src is tiled endlessly, and `x` & `y` may be up to a period past either end of it; when clamping, they must be within it.
+template<OutsideOfTextureSTMode tSTMode, int tComponentCount>
+inline void summedAreaCornerSums(const struct CGTextureMappingSummedAreaTable &table, int x, int y, uint32_t *out_sums)
+{
+	const int width = table.srcWidth, height = table.srcHeight;
+	const size_t sumsPerRow = (size_t)(width + 1) * tComponentCount;
+	int periodsX = 0, periodsY = 0;
+	if (tSTMode == OutsideOfTextureSTWrap) {
+		if (x < 0) {
+			x += width;
+			periodsX = -1;
+		}
+		else if (x > width) {
+			x -= width;
+			periodsX = 1;
+		}
+		if (y < 0) {
+			y += height;
+			periodsY = -1;
+		}
+		else if (y > height) {
+			y -= height;
+			periodsY = 1;
+		}
+	}
+	
+	const uint32_t *cornerSums = &table.sums[y * sumsPerRow + x * tComponentCount];
+	if (periodsX == 0 && periodsY == 0) {
+		for (int componentI = 0; componentI < tComponentCount; ++componentI)
+			out_sums[componentI] = cornerSums[componentI];
+		return;
+	}
+	// (plus the src's whole rows, whole columns, and whole self once per period the corner is past it; or less them, for a corner before it)
+	const uint32_t *rowEndSums = &table.sums[y * sumsPerRow + width * tComponentCount],
+		*columnEndSums = &table.sums[height * sumsPerRow + x * tComponentCount],
+		*srcSums = &table.sums[height * sumsPerRow + width * tComponentCount];
+	for (int componentI = 0; componentI < tComponentCount; ++componentI) {
+		out_sums[componentI] = cornerSums[componentI] + (uint32_t)periodsX * rowEndSums[componentI] + (uint32_t)periodsY * columnEndSums[componentI] +
+			(uint32_t)(periodsX * periodsY) * srcSums[componentI];
+	}
+}
+
+/// Summed-area-filtered sample of the src at `texelST` (see TextureFilterSummedArea): the average of the texels within a box the size of the footprint's bounding rectangle (rounded to whole texels, and shrunk in proportion to no more than kMaxSummedAreaTexelCount; or no more than the src along each axis) around the texel coord, from `info.summedAreaTable`.  When clamping, a box past the src's edge is moved back within it, rather than cut off.  A footprint under 1.5 texels along both axes takes the bilinear sample instead.
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor, int tComponentCount>
+void sampleTexelBytesSummedArea(const struct DestImageGenInfo &info, GLKVector2 texelST, const struct UVJacobian &uvJacobian, UInt8 *pixelByteBuffer)
+{
+	if (footprintMagnifies<TextureFilterSummedArea>(uvJacobian, info.srcSize_v2, 1.0f)) {
+		sampleTexelBytesBilinear<tSTMode, tWrapDivisor, TexelLayoutLinear, tComponentCount>(info, texelST, pixelByteBuffer);
+		return;
+	}
+	
+	const GLKVector2 footprint = footprintBoundingTexelSize(uvJacobian, info.srcSize_v2);
+	int boxWidth = (int)fmaxf(fminf(footprint.x + 0.5f, info.srcWidth_i), 1.0f),
+		boxHeight = (int)fmaxf(fminf(footprint.y + 0.5f, info.srcHeight_i), 1.0f);
+	if ((int64_t)boxWidth * boxHeight > kMaxSummedAreaTexelCount) {
+		const float scale = sqrtf((float)kMaxSummedAreaTexelCount / ((float)boxWidth * boxHeight));
+		boxWidth = (int)fmaxf(boxWidth * scale, 1.0f);
+		boxHeight = (int)fmaxf(boxHeight * scale, 1.0f);
+		// (in case the scale rounded up, or a side was already down to 1 texel)
+		if ((int64_t)boxWidth * boxHeight > kMaxSummedAreaTexelCount)
+			boxHeight = kMaxSummedAreaTexelCount / boxWidth;
+	}
+	
+	normalizeTexelSTCoord<tSTMode>(texelST.x);
+	normalizeTexelSTCoord<tSTMode>(texelST.y);
+	const GLKVector2 center = GLKVector2Multiply(texelST, info.srcSize_v2);
+	int startX = (int)floorf(center.x - boxWidth * 0.5f + 0.5f), startY = (int)floorf(center.y - boxHeight * 0.5f + 0.5f);
+	if (tSTMode == OutsideOfTextureSTClamp) {
+		startX = clamp_i(startX, 0, info.srcWidth_i - boxWidth);
+		startY = clamp_i(startY, 0, info.srcHeight_i - boxHeight);
+	}
+	
+	const struct CGTextureMappingSummedAreaTable &table = *info.summedAreaTable;
+	uint32_t startSums[tComponentCount], startYEndXSums[tComponentCount], startXEndYSums[tComponentCount], endSums[tComponentCount];
+	summedAreaCornerSums<tSTMode, tComponentCount>(table, startX, startY, startSums);
+	summedAreaCornerSums<tSTMode, tComponentCount>(table, startX + boxWidth, startY, startYEndXSums);
+	summedAreaCornerSums<tSTMode, tComponentCount>(table, startX, startY + boxHeight, startXEndYSums);
+	summedAreaCornerSums<tSTMode, tComponentCount>(table, startX + boxWidth, startY + boxHeight, endSums);
+	// (the sums' wrapping cancelling out, the box's sum being under 2^32)
+	const uint32_t texelCount = (uint32_t)boxWidth * boxHeight;
+	for (int componentI = 0; componentI < tComponentCount; ++componentI) {
+		const uint32_t boxSum = endSums[componentI] - startYEndXSums[componentI] - startXEndYSums[componentI] + startSums[componentI];
+		pixelByteBuffer[componentI] = (UInt8)((boxSum + texelCount / 2) / texelCount);
+	}
+}
+
+#pragma mark x86 SIMD Kernels
+
+#if defined(BLIT_KERNELS_AVX512) || defined(BLIT_KERNELS_AVX2) || defined(BLIT_KERNELS_SSE4_1)
+
+// Thin wrappers over the AVX-512, AVX2, or SSE4.1 intrinsics, so the kernels below are written once for every width.  Lane masks are mask registers for AVX-512, and all-ones/all-zeros float lanes otherwise.
+#if defined(BLIT_KERNELS_AVX512)
+	typedef __m512 SIMDFloats;
+	typedef __m512i SIMDInts;
+	typedef __mmask16 SIMDMask;
+	static const int kSIMDPixelCount = 16;
+	
+	static inline SIMDFloats simdFloats(const float value) { return _mm512_set1_ps(value); }
+	static inline SIMDFloats simdLoadFloats(const float *values) { return _mm512_loadu_ps(values); }
+	static inline SIMDInts simdInts(const int value) { return _mm512_set1_epi32(value); }
+	static inline SIMDInts simdLaneIndices() { return _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15); }
+	static inline SIMDMask simdAllLanes() { return (SIMDMask)0xffff; }
+	
+	static inline SIMDFloats simdAdd(const SIMDFloats a, const SIMDFloats b) { return _mm512_add_ps(a, b); }
+	static inline SIMDFloats simdSubtract(const SIMDFloats a, const SIMDFloats b) { return _mm512_sub_ps(a, b); }
+	static inline SIMDFloats simdMultiply(const SIMDFloats a, const SIMDFloats b) { return _mm512_mul_ps(a, b); }
+	static inline SIMDFloats simdTruncate(const SIMDFloats a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+	
+	static inline SIMDMask simdLessThan(const SIMDFloats a, const SIMDFloats b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+	static inline SIMDMask simdGreaterThan(const SIMDFloats a, const SIMDFloats b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+	static inline SIMDMask simdGreaterThanOrEqual(const SIMDFloats a, const SIMDFloats b) { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+	static inline SIMDMask simdIsNotNaN(const SIMDFloats a) { return _mm512_cmp_ps_mask(a, a, _CMP_ORD_Q); }
+	static inline SIMDMask simdAnd(const SIMDMask a, const SIMDMask b) { return a & b; }
+	static inline SIMDFloats simdSelect(const SIMDMask mask, const SIMDFloats ifSet, const SIMDFloats ifClear) { return _mm512_mask_blend_ps(mask, ifClear, ifSet); }
+	static inline int simdMaskBits(const SIMDMask mask) { return mask; }
+	
+	static inline SIMDInts simdTruncateToInts(const SIMDFloats a) { return _mm512_cvttps_epi32(a); }
+	static inline SIMDFloats simdToFloats(const SIMDInts a) { return _mm512_cvtepi32_ps(a); }
+	static inline SIMDInts simdAddInts(const SIMDInts a, const SIMDInts b) { return _mm512_add_epi32(a, b); }
+	static inline SIMDInts simdDecrementInts(const SIMDInts a, const SIMDMask mask) { return _mm512_mask_sub_epi32(a, mask, a, _mm512_set1_epi32(1)); }
+	static inline SIMDInts simdMultiplyInts(const SIMDInts a, const SIMDInts b) { return _mm512_mullo_epi32(a, b); }
+	static inline SIMDInts simdClampInts(const SIMDInts a, const SIMDInts l, const SIMDInts h) { return _mm512_min_epi32(_mm512_max_epi32(a, l), h); }
+	static inline SIMDInts simdLoadInts(const int *values) { return _mm512_loadu_si512(values); }
+	static inline void simdStoreInts(int *values, const SIMDInts a) { _mm512_storeu_si512(values, a); }
+	static inline SIMDInts simdSubtractInts(const SIMDInts a, const SIMDInts b) { return _mm512_sub_epi32(a, b); }
+	static inline SIMDInts simdShiftRightInts(const SIMDInts a, const int count) { return _mm512_sra_epi32(a, _mm_cvtsi32_si128(count)); }
+	static inline SIMDInts simdShiftLeftInts(const SIMDInts a, const int count) { return _mm512_sll_epi32(a, _mm_cvtsi32_si128(count)); }
+	static inline SIMDMask simdIntsLessThan(const SIMDInts a, const SIMDInts b) { return _mm512_cmplt_epi32_mask(a, b); }
+	static inline SIMDMask simdIntsGreaterThan(const SIMDInts a, const SIMDInts b) { return _mm512_cmpgt_epi32_mask(a, b); }
+	static inline SIMDInts simdSelectInts(const SIMDMask mask, const SIMDInts ifSet, const SIMDInts ifClear) { return _mm512_mask_blend_epi32(mask, ifClear, ifSet); }
+	static inline SIMDInts simdAndInts(const SIMDInts a, const SIMDInts b) { return _mm512_and_si512(a, b); }
+	static inline SIMDInts simdOrInts(const SIMDInts a, const SIMDInts b) { return _mm512_or_si512(a, b); }
+	// (the even lanes' 64-bit products, and the odd lanes' (shifted down into the even), their high halves then blended together)
+	static inline SIMDInts simdMultiplyHighUnsignedInts(const SIMDInts a, const SIMDInts b) { return _mm512_mask_blend_epi32(0xaaaa, _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32), _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32))); }
+	// (for 4-channel texels, a 32-bit word each; lanes not in the mask are left 0, or unwritten)
+	static inline SIMDInts simdGatherTexelWords(const UInt8 *srcBytes, const SIMDInts texelIndices, const SIMDMask lanes) { return _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), lanes, texelIndices, srcBytes, 4); }
+	static inline void simdStoreTexelWords(UInt8 *pixelBytes, const SIMDInts texelWords, const SIMDMask lanes) { _mm512_mask_storeu_epi32(pixelBytes, lanes, texelWords); }
+	static inline SIMDInts simdGatherInts(const int *values, const SIMDInts indices) { return _mm512_i32gather_epi32(indices, values, 4); }
+#elif defined(BLIT_KERNELS_AVX2)
+	typedef __m256 SIMDFloats;
+	typedef __m256i SIMDInts;
+	typedef __m256 SIMDMask;
+	static const int kSIMDPixelCount = 8;
+	
+	static inline SIMDFloats simdFloats(const float value) { return _mm256_set1_ps(value); }
+	static inline SIMDFloats simdLoadFloats(const float *values) { return _mm256_loadu_ps(values); }
+	static inline SIMDInts simdInts(const int value) { return _mm256_set1_epi32(value); }
+	static inline SIMDInts simdLaneIndices() { return _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7); }
+	static inline SIMDMask simdAllLanes() { return _mm256_castsi256_ps(_mm256_set1_epi32(-1)); }
+	
+	static inline SIMDFloats simdAdd(const SIMDFloats a, const SIMDFloats b) { return _mm256_add_ps(a, b); }
+	static inline SIMDFloats simdSubtract(const SIMDFloats a, const SIMDFloats b) { return _mm256_sub_ps(a, b); }
+	static inline SIMDFloats simdMultiply(const SIMDFloats a, const SIMDFloats b) { return _mm256_mul_ps(a, b); }
+	static inline SIMDFloats simdTruncate(const SIMDFloats a) { return _mm256_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+	
+	static inline SIMDMask simdLessThan(const SIMDFloats a, const SIMDFloats b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+	static inline SIMDMask simdGreaterThan(const SIMDFloats a, const SIMDFloats b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+	static inline SIMDMask simdGreaterThanOrEqual(const SIMDFloats a, const SIMDFloats b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+	static inline SIMDMask simdIsNotNaN(const SIMDFloats a) { return _mm256_cmp_ps(a, a, _CMP_ORD_Q); }
+	static inline SIMDMask simdAnd(const SIMDMask a, const SIMDMask b) { return _mm256_and_ps(a, b); }
+	static inline SIMDFloats simdSelect(const SIMDMask mask, const SIMDFloats ifSet, const SIMDFloats ifClear) { return _mm256_blendv_ps(ifClear, ifSet, mask); }
+	static inline int simdMaskBits(const SIMDMask mask) { return _mm256_movemask_ps(mask); }
+	
+	static inline SIMDInts simdTruncateToInts(const SIMDFloats a) { return _mm256_cvttps_epi32(a); }
+	static inline SIMDFloats simdToFloats(const SIMDInts a) { return _mm256_cvtepi32_ps(a); }
+	static inline SIMDInts simdAddInts(const SIMDInts a, const SIMDInts b) { return _mm256_add_epi32(a, b); }
+	// (the all-ones mask lanes are -1 as ints)
+	static inline SIMDInts simdDecrementInts(const SIMDInts a, const SIMDMask mask) { return _mm256_add_epi32(a, _mm256_castps_si256(mask)); }
+	static inline SIMDInts simdMultiplyInts(const SIMDInts a, const SIMDInts b) { return _mm256_mullo_epi32(a, b); }
+	static inline SIMDInts simdClampInts(const SIMDInts a, const SIMDInts l, const SIMDInts h) { return _mm256_min_epi32(_mm256_max_epi32(a, l), h); }
+	static inline SIMDInts simdLoadInts(const int *values) { return _mm256_loadu_si256((const __m256i *)values); }
+	static inline void simdStoreInts(int *values, const SIMDInts a) { _mm256_storeu_si256((__m256i *)values, a); }
+	static inline SIMDInts simdSubtractInts(const SIMDInts a, const SIMDInts b) { return _mm256_sub_epi32(a, b); }
+	static inline SIMDInts simdShiftRightInts(const SIMDInts a, const int count) { return _mm256_sra_epi32(a, _mm_cvtsi32_si128(count)); }
+	static inline SIMDInts simdShiftLeftInts(const SIMDInts a, const int count) { return _mm256_sll_epi32(a, _mm_cvtsi32_si128(count)); }
+	static inline SIMDMask simdIntsLessThan(const SIMDInts a, const SIMDInts b) { return _mm256_castsi256_ps(_mm256_cmpgt_epi32(b, a)); }
+	static inline SIMDMask simdIntsGreaterThan(const SIMDInts a, const SIMDInts b) { return _mm256_castsi256_ps(_mm256_cmpgt_epi32(a, b)); }
+	static inline SIMDInts simdSelectInts(const SIMDMask mask, const SIMDInts ifSet, const SIMDInts ifClear) { return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(ifClear), _mm256_castsi256_ps(ifSet), mask)); }
+	static inline SIMDInts simdAndInts(const SIMDInts a, const SIMDInts b) { return _mm256_and_si256(a, b); }
+	static inline SIMDInts simdOrInts(const SIMDInts a, const SIMDInts b) { return _mm256_or_si256(a, b); }
+	// (the even lanes' 64-bit products, and the odd lanes' (shifted down into the even), their high halves then blended together)
+	static inline SIMDInts simdMultiplyHighUnsignedInts(const SIMDInts a, const SIMDInts b) { return _mm256_blend_epi32(_mm256_srli_epi64(_mm256_mul_epu32(a, b), 32), _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32)), 0xaa); }
+	// (for 4-channel texels, a 32-bit word each; lanes not in the mask are left 0, or unwritten)
+	static inline SIMDInts simdGatherTexelWords(const UInt8 *srcBytes, const SIMDInts texelIndices, const SIMDMask lanes) { return _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), (const int *)srcBytes, texelIndices, _mm256_castps_si256(lanes), 4); }
+	static inline void simdStoreTexelWords(UInt8 *pixelBytes, const SIMDInts texelWords, const SIMDMask lanes) { _mm256_maskstore_epi32((int *)pixelBytes, _mm256_castps_si256(lanes), texelWords); }
+	static inline SIMDInts simdGatherInts(const int *values, const SIMDInts indices) { return _mm256_i32gather_epi32(values, indices, 4); }
+#else
+	typedef __m128 SIMDFloats;
+	typedef __m128i SIMDInts;
+	typedef __m128 SIMDMask;
+	static const int kSIMDPixelCount = 4;
+	
+	static inline SIMDFloats simdFloats(const float value) { return _mm_set1_ps(value); }
+	static inline SIMDFloats simdLoadFloats(const float *values) { return _mm_loadu_ps(values); }
+	static inline SIMDInts simdInts(const int value) { return _mm_set1_epi32(value); }
+	static inline SIMDInts simdLaneIndices() { return _mm_setr_epi32(0, 1, 2, 3); }
+	static inline SIMDMask simdAllLanes() { return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+	
+	static inline SIMDFloats simdAdd(const SIMDFloats a, const SIMDFloats b) { return _mm_add_ps(a, b); }
+	static inline SIMDFloats simdSubtract(const SIMDFloats a, const SIMDFloats b) { return _mm_sub_ps(a, b); }
+	static inline SIMDFloats simdMultiply(const SIMDFloats a, const SIMDFloats b) { return _mm_mul_ps(a, b); }
+	static inline SIMDFloats simdTruncate(const SIMDFloats a) { return _mm_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+	
+	static inline SIMDMask simdLessThan(const SIMDFloats a, const SIMDFloats b) { return _mm_cmplt_ps(a, b); }
+	static inline SIMDMask simdGreaterThan(const SIMDFloats a, const SIMDFloats b) { return _mm_cmpgt_ps(a, b); }
+	static inline SIMDMask simdGreaterThanOrEqual(const SIMDFloats a, const SIMDFloats b) { return _mm_cmpge_ps(a, b); }
+	static inline SIMDMask simdIsNotNaN(const SIMDFloats a) { return _mm_cmpord_ps(a, a); }
+	static inline SIMDMask simdAnd(const SIMDMask a, const SIMDMask b) { return _mm_and_ps(a, b); }
+	static inline SIMDFloats simdSelect(const SIMDMask mask, const SIMDFloats ifSet, const SIMDFloats ifClear) { return _mm_blendv_ps(ifClear, ifSet, mask); }
+	static inline int simdMaskBits(const SIMDMask mask) { return _mm_movemask_ps(mask); }
+	
+	static inline SIMDInts simdTruncateToInts(const SIMDFloats a) { return _mm_cvttps_epi32(a); }
+	static inline SIMDFloats simdToFloats(const SIMDInts a) { return _mm_cvtepi32_ps(a); }
+	static inline SIMDInts simdAddInts(const SIMDInts a, const SIMDInts b) { return _mm_add_epi32(a, b); }
+	// (the all-ones mask lanes are -1 as ints)
+	static inline SIMDInts simdDecrementInts(const SIMDInts a, const SIMDMask mask) { return _mm_add_epi32(a, _mm_castps_si128(mask)); }
+	static inline SIMDInts simdMultiplyInts(const SIMDInts a, const SIMDInts b) { return _mm_mullo_epi32(a, b); }
+	static inline SIMDInts simdClampInts(const SIMDInts a, const SIMDInts l, const SIMDInts h) { return _mm_min_epi32(_mm_max_epi32(a, l), h); }
+	static inline SIMDInts simdLoadInts(const int *values) { return _mm_loadu_si128((const __m128i *)values); }
+	static inline void simdStoreInts(int *values, const SIMDInts a) { _mm_storeu_si128((__m128i *)values, a); }
+	static inline SIMDInts simdSubtractInts(const SIMDInts a, const SIMDInts b) { return _mm_sub_epi32(a, b); }
+	static inline SIMDInts simdShiftRightInts(const SIMDInts a, const int count) { return _mm_sra_epi32(a, _mm_cvtsi32_si128(count)); }
+	static inline SIMDInts simdShiftLeftInts(const SIMDInts a, const int count) { return _mm_sll_epi32(a, _mm_cvtsi32_si128(count)); }
+	static inline SIMDMask simdIntsLessThan(const SIMDInts a, const SIMDInts b) { return _mm_castsi128_ps(_mm_cmplt_epi32(a, b)); }
+	static inline SIMDMask simdIntsGreaterThan(const SIMDInts a, const SIMDInts b) { return _mm_castsi128_ps(_mm_cmpgt_epi32(a, b)); }
+	static inline SIMDInts simdSelectInts(const SIMDMask mask, const SIMDInts ifSet, const SIMDInts ifClear) { return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(ifClear), _mm_castsi128_ps(ifSet), mask)); }
+	static inline SIMDInts simdAndInts(const SIMDInts a, const SIMDInts b) { return _mm_and_si128(a, b); }
+	static inline SIMDInts simdOrInts(const SIMDInts a, const SIMDInts b) { return _mm_or_si128(a, b); }
+	// (the even lanes' 64-bit products, and the odd lanes' (shifted down into the even), their high halves then blended together)
+	static inline SIMDInts simdMultiplyHighUnsignedInts(const SIMDInts a, const SIMDInts b) { return _mm_blend_epi16(_mm_srli_epi64(_mm_mul_epu32(a, b), 32), _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)), 0xcc); }
+	// (for 4-channel texels, a 32-bit word each; lanes not in the mask are left 0, or unwritten— a lane at a time, SSE4.1 having no gathers or masked stores)
+	static inline SIMDInts simdGatherTexelWords(const UInt8 *srcBytes, const SIMDInts texelIndices, const SIMDMask lanes)
+	{
+		int texelIndexLanes[kSIMDPixelCount], texelWordLanes[kSIMDPixelCount] = {};
+		_mm_storeu_si128((__m128i *)texelIndexLanes, texelIndices);
+		for (int laneBits = _mm_movemask_ps(lanes); laneBits != 0; laneBits &= laneBits - 1) {
+			const int laneI = __builtin_ctz(laneBits);
+			memcpy(&texelWordLanes[laneI], &srcBytes[(size_t)texelIndexLanes[laneI] * 4], 4);
+		}
+		return _mm_loadu_si128((const __m128i *)texelWordLanes);
+	}
+	static inline void simdStoreTexelWords(UInt8 *pixelBytes, const SIMDInts texelWords, const SIMDMask lanes)
+	{
+		int texelWordLanes[kSIMDPixelCount];
+		_mm_storeu_si128((__m128i *)texelWordLanes, texelWords);
+		for (int laneBits = _mm_movemask_ps(lanes); laneBits != 0; laneBits &= laneBits - 1) {
+			const int laneI = __builtin_ctz(laneBits);
+			memcpy(&pixelBytes[laneI * 4], &texelWordLanes[laneI], 4);
+		}
+	}
+	static inline SIMDInts simdGatherInts(const int *values, const SIMDInts indices)
+	{
+		return _mm_setr_epi32(values[_mm_extract_epi32(indices, 0)], values[_mm_extract_epi32(indices, 1)], values[_mm_extract_epi32(indices, 2)], values[_mm_extract_epi32(indices, 3)]);
+	}
+#endif
+
+/// nearestTexelIndex() for each lane.
+static inline SIMDInts simdNearestTexelIndices(const SIMDFloats texelCoords)
+{
+	const SIMDInts truncatedCoords = simdTruncateToInts(texelCoords);
+	return simdDecrementInts(truncatedCoords, simdLessThan(texelCoords, simdToFloats(truncatedCoords)));
+}
+
+/// normalizeTexelSTCoord() for each lane, with the same results bit for bit.
+template<OutsideOfTextureSTMode tSTMode> SIMDFloats simdNormalizeTexelSTCoords(const SIMDFloats coords);
+template<> inline SIMDFloats simdNormalizeTexelSTCoords<OutsideOfTextureSTWrap>(const SIMDFloats coords)
+{
+	const SIMDMask inRange = simdAnd(simdGreaterThanOrEqual(coords, simdFloats(0.0f)), simdLessThan(coords, simdFloats(1.0f)));
+	// `fmodf(coord, 1.0f)` is exactly the coord less its truncation
+	SIMDFloats remainders = simdSubtract(coords, simdTruncate(coords));
+	remainders = simdSelect(simdLessThan(remainders, simdFloats(0.0f)), simdAdd(remainders, simdFloats(1.0f)), remainders);
+	return simdSelect(inRange, coords, remainders);
+}
+template<> inline SIMDFloats simdNormalizeTexelSTCoords<OutsideOfTextureSTClamp>(const SIMDFloats coords)
+{
+	const SIMDFloats clampedLow = simdSelect(simdLessThan(coords, simdFloats(0.0f)), simdFloats(0.0f), coords);
+	return simdSelect(simdGreaterThan(clampedLow, simdFloats(kJustUnder1_0f)), simdFloats(kJustUnder1_0f), clampedLow);
+}
+
+/// Copies the src texels at `texelIndices` to the kSIMDPixelCount consecutive dest pixels at `pixelBytes`, for just the lanes set in `lanesToWrite`.
+template<int tComponentCount>
+inline void simdCopyTexelsToPixels(const struct DestImageGenInfo &info, const SIMDInts texelIndices, const SIMDMask lanesToWrite, UInt8 *pixelBytes)
+{
+	int texelIndexLanes[kSIMDPixelCount];
+	simdStoreInts(texelIndexLanes, texelIndices);
+	for (int laneBits = simdMaskBits(lanesToWrite); laneBits != 0; laneBits &= laneBits - 1) {
+		const int laneI = __builtin_ctz(laneBits);
+		copyBytesToPixelFromTexel<tComponentCount>(&pixelBytes[laneI * tComponentCount], &info.srcBytes[(size_t)texelIndexLanes[laneI] * tComponentCount]);
+	}
+}
+#if defined(BLIT_KERNELS_AVX512) || defined(BLIT_KERNELS_AVX2)
+	/// 4-channel texels are a 32-bit word each, so they're gathered & stored (masked) a whole batch at a time.
+	template<> inline void simdCopyTexelsToPixels<4>(const struct DestImageGenInfo &info, const SIMDInts texelIndices, const SIMDMask lanesToWrite, UInt8 *pixelBytes)
+	{
+		simdStoreTexelWords(pixelBytes, simdGatherTexelWords(info.srcBytes, texelIndices, lanesToWrite), lanesToWrite);
+	}
+#endif
+
+/// texelAxisIndex() for each lane, as ints (so for srcs whose texel indices fit in one; see `info.srcTexelIndicesFitInt`).
+template<TexelLayout tLayout>
+inline SIMDInts simdTexelAxisIndices(const struct DestImageGenInfo &info, const SIMDInts texelIs, const int axisI)
+{
+	if (tLayout == TexelLayoutTiled) {
+		const SIMDInts tileBits = simdAndInts(texelIs, simdInts(kSrcTileSize - 1));
+		const SIMDInts mortonBits = simdOrInts(simdOrInts(
+			simdAndInts(tileBits, simdInts(1)),
+			simdShiftLeftInts(simdAndInts(tileBits, simdInts(2)), 1)),
+			simdShiftLeftInts(simdAndInts(tileBits, simdInts(4)), 2)
+		);
+		const SIMDInts tileIs = simdShiftRightInts(texelIs, kSrcTileSizeBits);
+		if (axisI == 0)
+			return simdAddInts(simdShiftLeftInts(tileIs, 2 * kSrcTileSizeBits), mortonBits);
+		return simdAddInts(simdMultiplyInts(tileIs, simdInts(info.srcTileRowTexelCount)), simdShiftLeftInts(mortonBits, 1));
+	}
+	return (axisI == 0) ? texelIs : simdMultiplyInts(texelIs, simdInts(info.srcWidth_i));
+}
+
+/// texelIndex() for each lane, as ints (as simdTexelAxisIndices()).
+template<TexelLayout tLayout>
+inline SIMDInts simdTexelIndices(const struct DestImageGenInfo &info, const SIMDInts texelXs, const SIMDInts texelYs)
+{
+	return simdAddInts(simdTexelAxisIndices<tLayout>(info, texelYs, 1), simdTexelAxisIndices<tLayout>(info, texelXs, 0));
+}
+
+/// wrapTexelCoord() for each lane.
+template<TexelWrapDivisor tWrapDivisor> SIMDInts simdWrapTexelCoords(const SIMDInts coords, const struct TexelWrapPeriod &wrapPeriod);
+template<> inline SIMDInts simdWrapTexelCoords<TexelWrapDivisorPowerOfTwo>(const SIMDInts coords, const struct TexelWrapPeriod &wrapPeriod)
+{
+	return simdAndInts(coords, simdInts(wrapPeriod.period - 1));
+}
+template<> inline SIMDInts simdWrapTexelCoords<TexelWrapDivisorMagicNumber>(const SIMDInts coords, const struct TexelWrapPeriod &wrapPeriod)
+{
+	// (the quotients are below 2^31, so the arithmetic shift is as good as a logical one)
+	const SIMDInts quotients = simdShiftRightInts(simdMultiplyHighUnsignedInts(coords, simdInts((int)wrapPeriod.magicMultiplier)), wrapPeriod.magicShift);
+	return simdSubtractInts(coords, simdMultiplyInts(quotients, simdInts(wrapPeriod.period)));
+}
+
+/// sampleTexelBytes() for kSIMDPixelCount consecutive dest pixels at once (bit-exact with it), given each one's texel ST, or NaNs for pixels to skip (left untouched).
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+inline void simdSampleTexelBytes(const struct DestImageGenInfo &info, const float texelSs[], const float texelTs[], UInt8 *pixelBytes)
+{
+	SIMDFloats texelS = simdLoadFloats(texelSs), texelT = simdLoadFloats(texelTs);
+	const SIMDMask validLanes = simdAnd(simdIsNotNaN(texelS), simdIsNotNaN(texelT));
+	if (simdMaskBits(validLanes) == 0)
+		return;
+	
+	const bool wrapsAsInts = (tSTMode == OutsideOfTextureSTWrap && info.texelCoordsWrapAsInts);
+	if (!wrapsAsInts) {
+		texelS = simdNormalizeTexelSTCoords<tSTMode>(texelS);
+		texelT = simdNormalizeTexelSTCoords<tSTMode>(texelT);
+	}
+	SIMDInts nearestTexelX = simdNearestTexelIndices(simdMultiply(texelS, simdFloats(info.srcSize_v2.x))),
+		nearestTexelY = simdNearestTexelIndices(simdMultiply(texelT, simdFloats(info.srcSize_v2.y)));
+	if (wrapsAsInts) {
+		nearestTexelX = simdWrapTexelCoords<tWrapDivisor>(simdAddInts(nearestTexelX, simdInts(info.texelWrapPeriods[0].bias)), info.texelWrapPeriods[0]);
+		nearestTexelY = simdWrapTexelCoords<tWrapDivisor>(simdAddInts(nearestTexelY, simdInts(info.texelWrapPeriods[1].bias)), info.texelWrapPeriods[1]);
+	}
+	
+	simdCopyTexelsToPixels<tComponentCount>(info, simdTexelIndices<tLayout>(info, nearestTexelX, nearestTexelY), validLanes, pixelBytes);
+}
+
+/// The per-pixel loop of genDestSpanBytes_affine() for kSIMDPixelCount consecutive dest pixels from `pixelX` at once (bit-exact with it): maps, normalizes, clamps, and samples them.
+template<TexelLayout tLayout, int tComponentCount>
+inline void simdSampleAffineTexelBytes(const struct DestImageGenInfo &info, const int pixelX, const GLKVector2 uvBase, const GLKVector2 uvPerX, const GLKVector2 texelScale, const GLKVector2 texelShift, UInt8 *pixelBytes)
+{
+	const SIMDFloats pixelXs = simdToFloats(simdAddInts(simdInts(pixelX), simdLaneIndices()));
+	const SIMDFloats u = simdAdd(simdFloats(uvBase.x), simdMultiply(pixelXs, simdFloats(uvPerX.x))),
+		v = simdAdd(simdFloats(uvBase.y), simdMultiply(pixelXs, simdFloats(uvPerX.y)));
+	const SIMDFloats texelX = simdMultiply(simdSubtract(simdMultiply(u, simdFloats(texelScale.x)), simdFloats(texelShift.x)), simdFloats(info.srcSize_v2.x)),
+		texelY = simdMultiply(simdSubtract(simdMultiply(v, simdFloats(texelScale.y)), simdFloats(texelShift.y)), simdFloats(info.srcSize_v2.y));
+	const SIMDInts nearestTexelX = simdClampInts(simdNearestTexelIndices(texelX), simdInts(0), simdInts(info.srcWidth_i - 1)),
+		nearestTexelY = simdClampInts(simdNearestTexelIndices(texelY), simdInts(0), simdInts(info.srcHeight_i - 1));
+	
+	simdCopyTexelsToPixels<tComponentCount>(info, simdTexelIndices<tLayout>(info, nearestTexelX, nearestTexelY), simdAllLanes(), pixelBytes);
+}
+
+/// simdCopyTexelsToPixels() given the texels' x & y indices, for srcs whose texel indices may not fit in an int (`!info.srcTexelIndicesFitInt`), as 64K-sided ones' don't.
+template<TexelLayout tLayout, int tComponentCount>
+inline void simdCopyTexelsToPixels(const struct DestImageGenInfo &info, const SIMDInts texelXs, const SIMDInts texelYs, const SIMDMask lanesToWrite, UInt8 *pixelBytes)
+{
+	if (info.srcTexelIndicesFitInt) {
+		simdCopyTexelsToPixels<tComponentCount>(info, simdTexelIndices<tLayout>(info, texelXs, texelYs), lanesToWrite, pixelBytes);
+		return;
+	}
+	
+	int texelXLanes[kSIMDPixelCount], texelYLanes[kSIMDPixelCount];
+	simdStoreInts(texelXLanes, texelXs);
+	simdStoreInts(texelYLanes, texelYs);
+	for (int laneBits = simdMaskBits(lanesToWrite); laneBits != 0; laneBits &= laneBits - 1) {
+		const int laneI = __builtin_ctz(laneBits);
+		copyBytesToPixelFromTexel<tComponentCount>(&pixelBytes[laneI * tComponentCount], &info.srcBytes[texelIndex<tLayout>(info, texelXLanes[laneI], texelYLanes[laneI]) * tComponentCount]);
+	}
+}
+
+/// fixedPointTexelIndex() for each lane, with the same results.
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor>
+inline SIMDInts simdFixedPointTexelIndices(const struct DestImageGenInfo &info, const SIMDFloats texelSTs, const int axisI)
+{
+	const SIMDInts texelCoords = simdTruncateToInts(simdMultiply(texelSTs, simdFloats(info.fixedPointTexelScale.v[axisI])));
+	if (tSTMode == OutsideOfTextureSTWrap) {
+		const struct TexelWrapPeriod &wrapPeriod = info.texelWrapPeriods[axisI];
+		return simdShiftRightInts(simdWrapTexelCoords<tWrapDivisor>(simdAddInts(texelCoords, simdInts(wrapPeriod.bias)), wrapPeriod), info.texelFractionBits);
+	}
+	return simdClampInts(simdShiftRightInts(texelCoords, info.texelFractionBits), simdInts(0), simdInts((axisI == 0 ? info.srcWidth_i : info.srcHeight_i) - 1));
+}
+
+/// simdSampleTexelBytes() with fixed-point texel coords (bit-exact with sampleTexelBytesFixedPoint()).
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+inline void simdSampleTexelBytesFixedPoint(const struct DestImageGenInfo &info, const float texelSs[], const float texelTs[], UInt8 *pixelBytes)
+{
+	const SIMDFloats texelS = simdLoadFloats(texelSs), texelT = simdLoadFloats(texelTs);
+	const SIMDMask validLanes = simdAnd(simdIsNotNaN(texelS), simdIsNotNaN(texelT));
+	if (simdMaskBits(validLanes) == 0)
+		return;
+	
+	simdCopyTexelsToPixels<tLayout, tComponentCount>(info,
+		simdFixedPointTexelIndices<tSTMode, tWrapDivisor>(info, texelS, 0), simdFixedPointTexelIndices<tSTMode, tWrapDivisor>(info, texelT, 1),
+		validLanes, pixelBytes
+	);
+}
+
+/// stepFixedPointTexelCoord() for each lane.
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor>
+inline SIMDInts simdStepFixedPointTexelCoords(const SIMDInts coords, const SIMDInts deltas, const int period)
+{
+	const SIMDInts steppedCoords = simdAddInts(coords, deltas);
+	if (tSTMode != OutsideOfTextureSTWrap)
+		return steppedCoords;
+	if (tWrapDivisor == TexelWrapDivisorPowerOfTwo)
+		return simdAndInts(steppedCoords, simdInts(period - 1));
+	return simdSelectInts(simdIntsGreaterThan(steppedCoords, simdInts(period - 1)), simdSubtractInts(steppedCoords, simdInts(period)), steppedCoords);
+}
+
+/// affineFixedPointTexelIndex() for each lane.
+template<OutsideOfTextureSTMode tSTMode>
+inline SIMDInts simdAffineFixedPointTexelIndices(const SIMDInts coords, const int fractionBits, const int srcMaxIndex)
+{
+	if (tSTMode == OutsideOfTextureSTWrap)
+		return simdShiftRightInts(coords, fractionBits);
+	return simdClampInts(simdShiftRightInts(coords, fractionBits), simdInts(0), simdInts(srcMaxIndex));
+}
+
+/// texelCenterOffset() for each lane, with the same results.
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor>
+inline void simdTexelCenterOffsets(const struct DestImageGenInfo &info, SIMDFloats texelSTs, const int axisI, SIMDInts *out_lowerIndices, SIMDInts *out_upperWeights)
+{
+	const int srcSize = (axisI == 0) ? info.srcWidth_i : info.srcHeight_i;
+	SIMDInts lowerIndices;
+	if (info.texelFractionBits != 0) {
+		SIMDInts texelCoords = simdSubtractInts(simdTruncateToInts(simdMultiply(texelSTs, simdFloats(info.fixedPointTexelScale.v[axisI]))), simdInts(1 << (info.texelFractionBits - 1)));
+		const int weightShift = info.texelFractionBits - kBilinearWeightBits;
+		*out_upperWeights = simdShiftRightInts(simdAddInts(simdAndInts(texelCoords, simdInts((1 << info.texelFractionBits) - 1)), simdInts((1 << weightShift) >> 1)), weightShift);
+		if (tSTMode == OutsideOfTextureSTWrap)
+			texelCoords = simdWrapTexelCoords<tWrapDivisor>(simdAddInts(texelCoords, simdInts(info.texelWrapPeriods[axisI].bias)), info.texelWrapPeriods[axisI]);
+		lowerIndices = simdShiftRightInts(texelCoords, info.texelFractionBits);
+	}
+	else {
+		const bool wrapsAsInts = (tSTMode == OutsideOfTextureSTWrap && info.texelCoordsWrapAsInts);
+		if (!wrapsAsInts)
+			texelSTs = simdNormalizeTexelSTCoords<tSTMode>(texelSTs);
+		
+		const SIMDFloats texelCoords = simdSubtract(simdMultiply(texelSTs, simdFloats(info.srcSize_v2.v[axisI])), simdFloats(0.5f));
+		lowerIndices = simdNearestTexelIndices(texelCoords);
+		*out_upperWeights = simdTruncateToInts(simdAdd(simdMultiply(simdSubtract(texelCoords, simdToFloats(lowerIndices)), simdFloats(kBilinearWeightOne)), simdFloats(0.5f)));
+		if (wrapsAsInts)
+			lowerIndices = simdWrapTexelCoords<tWrapDivisor>(simdAddInts(lowerIndices, simdInts(info.texelWrapPeriods[axisI].bias)), info.texelWrapPeriods[axisI]);
+		else if (tSTMode == OutsideOfTextureSTWrap)
+			lowerIndices = simdSelectInts(simdIntsLessThan(lowerIndices, simdInts(0)), simdAddInts(lowerIndices, simdInts(srcSize)), lowerIndices);
+	}
+	*out_lowerIndices = lowerIndices;
+}
+
+/// bilinearTexelPair() for each lane, with the same results.
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor>
+inline void simdBilinearTexelPairs(const struct DestImageGenInfo &info, const SIMDFloats texelSTs, const int axisI, SIMDInts *out_lowerIndices, SIMDInts *out_upperIndices, SIMDInts *out_upperWeights)
+{
+	const int srcSize = (axisI == 0) ? info.srcWidth_i : info.srcHeight_i;
+	SIMDInts lowerIndices;
+	simdTexelCenterOffsets<tSTMode, tWrapDivisor>(info, texelSTs, axisI, &lowerIndices, out_upperWeights);
+	
+	const SIMDInts nextIndices = simdAddInts(lowerIndices, simdInts(1));
+	if (tSTMode == OutsideOfTextureSTWrap) {
+		*out_lowerIndices = lowerIndices;
+		*out_upperIndices = simdSelectInts(simdIntsLessThan(nextIndices, simdInts(srcSize)), nextIndices, simdInts(0));
+	}
+	else {
+		*out_lowerIndices = simdClampInts(lowerIndices, simdInts(0), simdInts(srcSize - 1));
+		*out_upperIndices = simdClampInts(nextIndices, simdInts(0), simdInts(srcSize - 1));
+	}
+}
+
+/// blendBilinearTexels() for kSIMDPixelCount consecutive dest pixels at `pixelBytes`, for just the lanes set in `lanesToWrite`, a lane at a time.
+template<TexelLayout tLayout, int tComponentCount>
+inline void simdBlendBilinearTexels(const struct DestImageGenInfo &info, const SIMDInts pairXs[3], const SIMDInts pairYs[3], const SIMDMask lanesToWrite, UInt8 *pixelBytes)
+{
+	// ([0]: lower indices, [1]: upper indices, [2]: upper weights)
+	int pairXLanes[3][kSIMDPixelCount], pairYLanes[3][kSIMDPixelCount];
+	for (int fieldI = 0; fieldI < 3; ++fieldI) {
+		simdStoreInts(pairXLanes[fieldI], pairXs[fieldI]);
+		simdStoreInts(pairYLanes[fieldI], pairYs[fieldI]);
+	}
+	for (int laneBits = simdMaskBits(lanesToWrite); laneBits != 0; laneBits &= laneBits - 1) {
+		const int laneI = __builtin_ctz(laneBits);
+		const struct BilinearTexelPair pairX = { pairXLanes[0][laneI], pairXLanes[1][laneI], pairXLanes[2][laneI] },
+			pairY = { pairYLanes[0][laneI], pairYLanes[1][laneI], pairYLanes[2][laneI] };
+		blendBilinearTexels<tLayout, tComponentCount>(info, pairX, pairY, &pixelBytes[laneI * tComponentCount]);
+	}
+}
+
+/// lerpChannel() for all 4 channels of a lane's texel words at once: channels 0 & 2 (then 1 & 3) are masked into the low bytes of the lane's two 16-bit halves, where each times its weight (and the two weighted channels' sum) stays within the half, so one 32-bit multiply-add weights both.
+static inline SIMDInts simdLerpTexelWords(const SIMDInts lowerWords, const SIMDInts upperWords, const SIMDInts upperWeights)
+{
+	const SIMDInts evenChannelsMask = simdInts(0x00ff00ff), halfRounding = simdInts((kBilinearWeightOne / 2) * 0x00010001);
+	const SIMDInts lowerWeights = simdSubtractInts(simdInts(kBilinearWeightOne), upperWeights);
+	const SIMDInts evenChannels = simdAddInts(simdAddInts(
+		simdMultiplyInts(simdAndInts(lowerWords, evenChannelsMask), lowerWeights),
+		simdMultiplyInts(simdAndInts(upperWords, evenChannelsMask), upperWeights)
+	), halfRounding);
+	const SIMDInts oddChannels = simdAddInts(simdAddInts(
+		simdMultiplyInts(simdAndInts(simdShiftRightInts(lowerWords, 8), evenChannelsMask), lowerWeights),
+		simdMultiplyInts(simdAndInts(simdShiftRightInts(upperWords, 8), evenChannelsMask), upperWeights)
+	), halfRounding);
+	// (each half's top byte is its channel's blend; the odd channels' are already in place)
+	return simdOrInts(simdAndInts(simdShiftRightInts(evenChannels, kBilinearWeightBits), evenChannelsMask), simdAndInts(oddChannels, simdInts(0xff00ff00)));
+}
+/// simdBlendBilinearTexels() for 4-channel texels, gathered a batch at a time (so their indices must fit in an int) and blended with simdLerpTexelWords().
+template<TexelLayout tLayout>
+inline void simdBlendBilinearTexelWords(const struct DestImageGenInfo &info, const SIMDInts pairXs[3], const SIMDInts pairYs[3], const SIMDMask lanesToWrite, UInt8 *pixelBytes)
+{
+	const SIMDInts lowerRowStarts = simdTexelAxisIndices<tLayout>(info, pairYs[0], 1), upperRowStarts = simdTexelAxisIndices<tLayout>(info, pairYs[1], 1);
+	const SIMDInts lowerColumnIndices = simdTexelAxisIndices<tLayout>(info, pairXs[0], 0), upperColumnIndices = simdTexelAxisIndices<tLayout>(info, pairXs[1], 0);
+	const SIMDInts lowerRowWords = simdLerpTexelWords(
+		simdGatherTexelWords(info.srcBytes, simdAddInts(lowerRowStarts, lowerColumnIndices), lanesToWrite),
+		simdGatherTexelWords(info.srcBytes, simdAddInts(lowerRowStarts, upperColumnIndices), lanesToWrite),
+		pairXs[2]
+	);
+	const SIMDInts upperRowWords = simdLerpTexelWords(
+		simdGatherTexelWords(info.srcBytes, simdAddInts(upperRowStarts, lowerColumnIndices), lanesToWrite),
+		simdGatherTexelWords(info.srcBytes, simdAddInts(upperRowStarts, upperColumnIndices), lanesToWrite),
+		pairXs[2]
+	);
+	simdStoreTexelWords(pixelBytes, simdLerpTexelWords(lowerRowWords, upperRowWords, pairYs[2]), lanesToWrite);
+}
+
+/// sampleTexelBytesBilinear() for kSIMDPixelCount consecutive dest pixels at once (bit-exact with it), given each one's texel ST, or NaNs for pixels to skip (left untouched).
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+inline void simdSampleTexelBytesBilinear(const struct DestImageGenInfo &info, const SIMDFloats texelS, const SIMDFloats texelT, UInt8 *pixelBytes)
+{
+	const SIMDMask validLanes = simdAnd(simdIsNotNaN(texelS), simdIsNotNaN(texelT));
+	if (simdMaskBits(validLanes) == 0)
+		return;
+	
+	SIMDInts pairXs[3], pairYs[3];
+	simdBilinearTexelPairs<tSTMode, tWrapDivisor>(info, texelS, 0, &pairXs[0], &pairXs[1], &pairXs[2]);
+	simdBilinearTexelPairs<tSTMode, tWrapDivisor>(info, texelT, 1, &pairYs[0], &pairYs[1], &pairYs[2]);
+	if (tComponentCount == 4 && info.srcTexelIndicesFitInt)
+		simdBlendBilinearTexelWords<tLayout>(info, pairXs, pairYs, validLanes, pixelBytes);
+	else
+		simdBlendBilinearTexels<tLayout, tComponentCount>(info, pairXs, pairYs, validLanes, pixelBytes);
+}
+
+/// resamplingTaps() for each lane, with the same results: each tap's texel indices into `out_indices`, and each lane's row of `info.resamplingWeights` into `out_weightRowStarts` (as an index into the whole table, for simdGatherInts()).  Lanes not in `validLanes` get the first texel & row, so they gather within the src & table.
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor, int tTapCount>
+inline void simdResamplingTaps(const struct DestImageGenInfo &info, const SIMDFloats texelSTs, const int axisI, const SIMDMask validLanes, SIMDInts out_indices[tTapCount], SIMDInts *out_weightRowStarts)
+{
+	static const int kFirstTapOffset = 1 - tTapCount / 2;
+	
+	const int srcSize = (axisI == 0) ? info.srcWidth_i : info.srcHeight_i;
+	SIMDInts lowerIndices, phases;
+	simdTexelCenterOffsets<tSTMode, tWrapDivisor>(info, texelSTs, axisI, &lowerIndices, &phases);
+	lowerIndices = simdSelectInts(validLanes, lowerIndices, simdInts(0));
+	*out_weightRowStarts = simdMultiplyInts(simdSelectInts(validLanes, phases, simdInts(0)), simdInts(kMaxResamplingTapCount));
+	
+	for (int tapI = 0; tapI < tTapCount; ++tapI) {
+		const SIMDInts texelIs = simdAddInts(lowerIndices, simdInts(kFirstTapOffset + tapI));
+		if (tSTMode == OutsideOfTextureSTWrap) {
+			if (srcSize >= tTapCount) {
+				const SIMDInts upWrapped = simdSelectInts(simdIntsLessThan(texelIs, simdInts(0)), simdAddInts(texelIs, simdInts(srcSize)), texelIs);
+				out_indices[tapI] = simdSelectInts(simdIntsGreaterThan(upWrapped, simdInts(srcSize - 1)), simdSubtractInts(upWrapped, simdInts(srcSize)), upWrapped);
+			}
+			else {
+				// (a src narrower than the filter, where a tap may be periods out; rare, and cheap to sample anyway)
+				int texelILanes[kSIMDPixelCount];
+				simdStoreInts(texelILanes, texelIs);
+				for (int laneI = 0; laneI < kSIMDPixelCount; ++laneI)
+					texelILanes[laneI] = modulo_i(texelILanes[laneI], srcSize);
+				out_indices[tapI] = simdLoadInts(texelILanes);
+			}
+		}
+		else
+			out_indices[tapI] = simdClampInts(texelIs, simdInts(0), simdInts(srcSize - 1));
+	}
+}
+
+/// blendResamplingTexels() for kSIMDPixelCount consecutive dest pixels at `pixelBytes`, for just the lanes set in `lanesToWrite`, a lane at a time.
+template<int tTapCount, int tComponentCount>
+inline void simdBlendResamplingTexels(const struct DestImageGenInfo &info, const SIMDInts indicesX[tTapCount], const SIMDInts weightRowStartsX, const SIMDInts indicesY[tTapCount], const SIMDInts weightRowStartsY, const SIMDMask lanesToWrite, UInt8 *pixelBytes)
+{
+	const int *weightTable = &info.resamplingWeights->weights[0][0];
+	int indexXLanes[tTapCount][kSIMDPixelCount], indexYLanes[tTapCount][kSIMDPixelCount], weightRowStartXLanes[kSIMDPixelCount], weightRowStartYLanes[kSIMDPixelCount];
+	for (int tapI = 0; tapI < tTapCount; ++tapI) {
+		simdStoreInts(indexXLanes[tapI], indicesX[tapI]);
+		simdStoreInts(indexYLanes[tapI], indicesY[tapI]);
+	}
+	simdStoreInts(weightRowStartXLanes, weightRowStartsX);
+	simdStoreInts(weightRowStartYLanes, weightRowStartsY);
+	for (int laneBits = simdMaskBits(lanesToWrite); laneBits != 0; laneBits &= laneBits - 1) {
+		const int laneI = __builtin_ctz(laneBits);
+		struct ResamplingTaps<tTapCount> tapsX, tapsY;
+		for (int tapI = 0; tapI < tTapCount; ++tapI) {
+			tapsX.indices[tapI] = indexXLanes[tapI][laneI];
+			tapsY.indices[tapI] = indexYLanes[tapI][laneI];
+		}
+		tapsX.weights = &weightTable[weightRowStartXLanes[laneI]];
+		tapsY.weights = &weightTable[weightRowStartYLanes[laneI]];
+		blendResamplingTexels<tTapCount, tComponentCount>(info, tapsX, tapsY, &pixelBytes[laneI * tComponentCount]);
+	}
+}
+/// resampledChannel() for each lane.
+static inline SIMDInts simdResampledChannels(const SIMDInts weightedSums)
+{
+	return simdShiftRightInts(simdAddInts(weightedSums, simdInts(1 << (kResamplingWeightBits - 1))), kResamplingWeightBits);
+}
+/// simdBlendResamplingTexels() for 4-channel texels, gathered a batch at a time (so their indices must fit in an int), each channel masked out of its texel words and weighted in its own int lanes (the weights, 15 bits or so signed, leaving too little room to pack two channels a lane as simdLerpTexelWords() does).
+template<int tTapCount>
+inline void simdBlendResamplingTexelWords(const struct DestImageGenInfo &info, const SIMDInts indicesX[tTapCount], const SIMDInts weightRowStartsX, const SIMDInts indicesY[tTapCount], const SIMDInts weightRowStartsY, const SIMDMask lanesToWrite, UInt8 *pixelBytes)
+{
+	const int *weightTable = &info.resamplingWeights->weights[0][0];
+	const SIMDInts srcWidths = simdInts(info.srcWidth_i), channelMask = simdInts(0xff);
+	SIMDInts weightsX[tTapCount];
+	for (int tapX = 0; tapX < tTapCount; ++tapX)
+		weightsX[tapX] = simdGatherInts(weightTable, simdAddInts(weightRowStartsX, simdInts(tapX)));
+	
+	SIMDInts channelSums[4] = { simdInts(0), simdInts(0), simdInts(0), simdInts(0) };
+	for (int tapY = 0; tapY < tTapCount; ++tapY) {
+		const SIMDInts rowStarts = simdMultiplyInts(indicesY[tapY], srcWidths);
+		SIMDInts rowSums[4] = { simdInts(0), simdInts(0), simdInts(0), simdInts(0) };
+		for (int tapX = 0; tapX < tTapCount; ++tapX) {
+			const SIMDInts texelWords = simdGatherTexelWords(info.srcBytes, simdAddInts(rowStarts, indicesX[tapX]), lanesToWrite);
+			for (int channelI = 0; channelI < 4; ++channelI)
+				rowSums[channelI] = simdAddInts(rowSums[channelI], simdMultiplyInts(simdAndInts(simdShiftRightInts(texelWords, channelI * 8), channelMask), weightsX[tapX]));
+		}
+		const SIMDInts weightsY = simdGatherInts(weightTable, simdAddInts(weightRowStartsY, simdInts(tapY)));
+		for (int channelI = 0; channelI < 4; ++channelI)
+			channelSums[channelI] = simdAddInts(channelSums[channelI], simdMultiplyInts(simdResampledChannels(rowSums[channelI]), weightsY));
+	}
+	
+	SIMDInts pixelWords = simdInts(0);
+	for (int channelI = 0; channelI < 4; ++channelI)
+		pixelWords = simdOrInts(pixelWords, simdShiftLeftInts(simdClampInts(simdResampledChannels(channelSums[channelI]), simdInts(0), simdInts(UINT8_MAX)), channelI * 8));
+	simdStoreTexelWords(pixelBytes, pixelWords, lanesToWrite);
+}
+
+/// sampleTexelBytesResampled() for kSIMDPixelCount consecutive dest pixels at once (bit-exact with it), given each one's texel ST, or NaNs for pixels to skip (left untouched).
+template<OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, int tComponentCount>
+inline void simdSampleTexelBytesResampled(const struct DestImageGenInfo &info, const SIMDFloats texelS, const SIMDFloats texelT, UInt8 *pixelBytes)
+{
+	static const int kTapCount = resamplingTapCount(tFilterMode);
+	
+	const SIMDMask validLanes = simdAnd(simdIsNotNaN(texelS), simdIsNotNaN(texelT));
+	if (simdMaskBits(validLanes) == 0)
+		return;
+	
+	SIMDInts indicesX[kTapCount], indicesY[kTapCount], weightRowStartsX, weightRowStartsY;
+	simdResamplingTaps<tSTMode, tWrapDivisor, kTapCount>(info, texelS, 0, validLanes, indicesX, &weightRowStartsX);
+	simdResamplingTaps<tSTMode, tWrapDivisor, kTapCount>(info, texelT, 1, validLanes, indicesY, &weightRowStartsY);
+	if (tComponentCount == 4 && info.srcTexelIndicesFitInt)
+		simdBlendResamplingTexelWords<kTapCount>(info, indicesX, weightRowStartsX, indicesY, weightRowStartsY, validLanes, pixelBytes);
+	else
+		simdBlendResamplingTexels<kTapCount, tComponentCount>(info, indicesX, weightRowStartsX, indicesY, weightRowStartsY, validLanes, pixelBytes);
+}
+
+/// sampleTexelBytesTrilinear() for kSIMDPixelCount consecutive dest pixels at once (bit-exact with it), given each one's texel ST (or NaNs for pixels to skip, as for simdSampleTexelBytesBilinear()) and MipLevelBlend.
+/// 	The lanes are sampled a lower level at a time (all at once, where they share one, as neighboring pixels mostly do): with simdSampleTexelBytesBilinear() at that level, and at the next if any of its lanes take some of it, then blended.
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor, int tComponentCount>
+inline void simdSampleTexelBytesTrilinear(const struct DestImageGenInfo &info, const float texelSs[], const float texelTs[], const int lowerLevels[], const int upperWeights[], UInt8 *pixelBytes)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	const SIMDFloats texelT = simdLoadFloats(texelTs);
+	int unsampledLaneBits = simdMaskBits(simdAnd(simdIsNotNaN(simdLoadFloats(texelSs)), simdIsNotNaN(texelT)));
+	while (unsampledLaneBits != 0) {
+		const int lowerLevel = lowerLevels[__builtin_ctz(unsampledLaneBits)];
+		
+		float levelTexelSs[kSIMDPixelCount];
+		int levelLaneBits = 0;
+		bool takesUpperLevel = false;
+		for (int laneI = 0; laneI < kSIMDPixelCount; ++laneI) {
+			const bool isLevelLane = ((unsampledLaneBits >> laneI) & 1) && lowerLevels[laneI] == lowerLevel;
+			levelTexelSs[laneI] = isLevelLane ? texelSs[laneI] : NAN;
+			levelLaneBits |= (int)isLevelLane << laneI;
+			takesUpperLevel = takesUpperLevel || (isLevelLane && upperWeights[laneI] != 0);
+		}
+		unsampledLaneBits &= ~levelLaneBits;
+		
+		const SIMDFloats levelTexelS = simdLoadFloats(levelTexelSs);
+		if (!takesUpperLevel) {
+			simdSampleTexelBytesBilinear<tSTMode, tWrapDivisor, TexelLayoutLinear, tComponentCount>(info.mipLevelInfos[lowerLevel], levelTexelS, texelT, pixelBytes);
+			continue;
+		}
+		
+		// (a word per lane is room for a pixel of any channel count)
+		int lowerLevelWords[kSIMDPixelCount] = {}, upperLevelWords[kSIMDPixelCount] = {};
+		simdSampleTexelBytesBilinear<tSTMode, tWrapDivisor, TexelLayoutLinear, tComponentCount>(info.mipLevelInfos[lowerLevel], levelTexelS, texelT, (UInt8 *)lowerLevelWords);
+		simdSampleTexelBytesBilinear<tSTMode, tWrapDivisor, TexelLayoutLinear, tComponentCount>(info.mipLevelInfos[lowerLevel + 1], levelTexelS, texelT, (UInt8 *)upperLevelWords);
+		if (tComponentCount == 4) {
+			const SIMDMask levelLanes = simdAnd(simdIsNotNaN(levelTexelS), simdIsNotNaN(texelT));
+			simdStoreTexelWords(pixelBytes, simdLerpTexelWords(simdLoadInts(lowerLevelWords), simdLoadInts(upperLevelWords), simdLoadInts(upperWeights)), levelLanes);
+		}
+		else {
+			const UInt8 *lowerLevelBytes = (const UInt8 *)lowerLevelWords, *upperLevelBytes = (const UInt8 *)upperLevelWords;
+			for (int laneBits = levelLaneBits; laneBits != 0; laneBits &= laneBits - 1) {
+				const int laneI = __builtin_ctz(laneBits);
+				for (int byteI = laneI * kBytesPerPixel; byteI < (laneI + 1) * kBytesPerPixel; ++byteI)
+					pixelBytes[byteI] = (UInt8)lerpChannel(lowerLevelBytes[byteI], upperLevelBytes[byteI], upperWeights[laneI]);
+			}
+		}
+	}
+}
+
+#endif // defined(BLIT_KERNELS_AVX512) || defined(BLIT_KERNELS_AVX2) || defined(BLIT_KERNELS_SSE4_1)
+
+
+#pragma mark Dest Image Generation
+
+/// Samples the src at a single pixel's `texelST` per `tFilterMode`, the pixel's coords giving its footprint (for the filter modes that track footprints).
+template<OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+inline void sampleTexelBytesFiltered(const struct DestImageGenInfo &info, const GLKVector2 texelST, const int pixelX, const int pixelY, UInt8 *pixelByteBuffer)
+{
+	if (filterModeTracksFootprint(tFilterMode)) {
+		if (tFilterMode == TextureFilterEWA)
+			sampleTexelBytesEWA<tSTMode, tWrapDivisor, tComponentCount>(info, texelST, uvJacobianAtPixel(info, pixelX, pixelY), pixelByteBuffer);
+		else if (tFilterMode == TextureFilterSummedArea)
+			sampleTexelBytesSummedArea<tSTMode, tWrapDivisor, tComponentCount>(info, texelST, uvJacobianAtPixel(info, pixelX, pixelY), pixelByteBuffer);
+		else
+			sampleTexelBytesTrilinear<tSTMode, tWrapDivisor, tComponentCount>(info, texelST, mipLevelBlend(mipLODAtPixel(info, pixelX, pixelY)), pixelByteBuffer);
+	}
+	else if (tFilterMode == TextureFilterBilinear)
+		sampleTexelBytesBilinear<tSTMode, tWrapDivisor, tLayout, tComponentCount>(info, texelST, pixelByteBuffer);
+	else if (filterModeResamples(tFilterMode))
+		sampleTexelBytesResampled<tSTMode, tFilterMode, tWrapDivisor, tComponentCount>(info, texelST, pixelByteBuffer);
+	else
+		sampleTexelBytes<tSTMode, tWrapDivisor, tLayout, tComponentCount>(info, texelST, pixelByteBuffer);
+}
+
+/// Per-pixel reference path: maps & samples a single pixel with no state carried between pixels.
+template<OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+void genDestImagePixelBytes(const struct DestImageGenInfo &info, const GLKVector2 pixelST, UInt8 *pixelByteBuffer)
+{
+	GLKVector2 texelST = surfaceSTToTexelUV_bilinearQuad<tUVMode>(info, pixelST);
+	if (GLKVector2IsInvalid(texelST))
+		return;
+	
+	// (the pixel's coords, back from its ST)
+	const int pixelX = (int)(pixelST.x * info.destWidth_i + 0.5f), pixelY = (int)(pixelST.y * info.destHeight_i + 0.5f);
+	sampleTexelBytesFiltered<tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, texelST, pixelX, pixelY, pixelByteBuffer);
+}
+
+/// Scanline traversal: walks `[spanStartX, spanEndX)` of one dest row in memory order (so consecutive writes are adjacent), with everything that's constant for the row hoisted out of the per-pixel path and the mapping stepped incrementally by a QuadScanlineEvaluator.
+/// 	When skipping, only the part of the span within `info.coverageConstraintHalfPlanes` is walked; the rest is left untouched, as skipped pixels always are (so it keeps whatever the DestBufferAllocator filled it with— transparent black, for the default one).
+template<QuadMappingMode tMappingMode, OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+void genDestImageRowBytes(const struct DestImageGenInfo &info, const int pixelY, const int spanStartX, const int spanEndX, UInt8 *rowByteBuffer)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	int startX = spanStartX, endX = spanEndX;
+	if (tUVMode == OutsideOfQuadUVSkip)
+		narrowSpanToCoverage(info, pixelY, &startX, &endX);
+	if (startX >= endX)
+		return;
+	
+	// started on a resync boundary and stepped up to the span, so it steps exactly as it would from the start of the row (and so the output doesn't depend on how the row is split into spans)
+	const int evaluatorStartX = startX - startX % kScanlineResyncInterval;
+	QuadScanlineEvaluator<tMappingMode, tUVMode> evaluator(info, pixelY, evaluatorStartX);
+	
+	if (tFilterMode == TextureFilterEWA || tFilterMode == TextureFilterSummedArea) {
+		// (a pixel at a time for every ISA: each EWA pixel's footprint taking its own count of texels, and each summed-area pixel just 4 lookups per channel, but anywhere in the table)
+		UInt8 *pixelBytes = &rowByteBuffer[evaluatorStartX * kBytesPerPixel];
+		for (int pixelX = evaluatorStartX; pixelX < endX; ++pixelX, pixelBytes += kBytesPerPixel) {
+			GLKVector2 texelST = evaluator.nextTexelUV();
+			if (pixelX < startX || GLKVector2IsInvalid(texelST))
+				continue;
+			
+			if (tFilterMode == TextureFilterEWA)
+				sampleTexelBytesEWA<tSTMode, tWrapDivisor, tComponentCount>(info, texelST, uvJacobianAtPixel(info, pixelX, pixelY), pixelBytes);
+			else
+				sampleTexelBytesSummedArea<tSTMode, tWrapDivisor, tComponentCount>(info, texelST, uvJacobianAtPixel(info, pixelX, pixelY), pixelBytes);
+		}
+		return;
+	}
+	
+#if defined(BLIT_KERNELS_AVX512) || defined(BLIT_KERNELS_AVX2) || defined(BLIT_KERNELS_SSE4_1)
+	// mapped a batch at a time, then sampled by the SIMD kernel
+	float batchTexelSs[kSIMDPixelCount], batchTexelTs[kSIMDPixelCount];
+	int batchLowerLevels[kSIMDPixelCount], batchUpperWeights[kSIMDPixelCount];
+	for (int batchStartX = evaluatorStartX; batchStartX < endX; batchStartX += kSIMDPixelCount) {
+		for (int laneI = 0; laneI < kSIMDPixelCount; ++laneI) {
+			const int pixelX = batchStartX + laneI;
+			GLKVector2 texelST = (pixelX < endX) ? evaluator.nextTexelUV() : GLKVector2Invalid;
+			batchTexelSs[laneI] = (pixelX < startX) ? NAN : texelST.x;
+			batchTexelTs[laneI] = texelST.y;
+			if (tFilterMode == TextureFilterTrilinear) {
+				const struct MipLevelBlend levelBlend = (pixelX >= startX && pixelX < endX) ? mipLevelBlend(mipLODAtPixel(info, pixelX, pixelY)) : (struct MipLevelBlend){ 0, 0 };
+				batchLowerLevels[laneI] = levelBlend.lowerLevel;
+				batchUpperWeights[laneI] = levelBlend.upperWeight;
+			}
+		}
+		if (tFilterMode == TextureFilterTrilinear)
+			simdSampleTexelBytesTrilinear<tSTMode, tWrapDivisor, tComponentCount>(info, batchTexelSs, batchTexelTs, batchLowerLevels, batchUpperWeights, &rowByteBuffer[batchStartX * kBytesPerPixel]);
+		else if (tFilterMode == TextureFilterBilinear)
+			simdSampleTexelBytesBilinear<tSTMode, tWrapDivisor, tLayout, tComponentCount>(info, simdLoadFloats(batchTexelSs), simdLoadFloats(batchTexelTs), &rowByteBuffer[batchStartX * kBytesPerPixel]);
+		else if (filterModeResamples(tFilterMode))
+			simdSampleTexelBytesResampled<tSTMode, tFilterMode, tWrapDivisor, tComponentCount>(info, simdLoadFloats(batchTexelSs), simdLoadFloats(batchTexelTs), &rowByteBuffer[batchStartX * kBytesPerPixel]);
+		else if (info.texelFractionBits != 0)
+			simdSampleTexelBytesFixedPoint<tSTMode, tWrapDivisor, tLayout, tComponentCount>(info, batchTexelSs, batchTexelTs, &rowByteBuffer[batchStartX * kBytesPerPixel]);
+		else
+			simdSampleTexelBytes<tSTMode, tWrapDivisor, tLayout, tComponentCount>(info, batchTexelSs, batchTexelTs, &rowByteBuffer[batchStartX * kBytesPerPixel]);
+	}
+#else
+	UInt8 *pixelBytes = &rowByteBuffer[evaluatorStartX * kBytesPerPixel];
+	for (int pixelX = evaluatorStartX; pixelX < endX; ++pixelX, pixelBytes += kBytesPerPixel) {
+		GLKVector2 texelST = evaluator.nextTexelUV();
+		if (pixelX < startX || GLKVector2IsInvalid(texelST))
+			continue;
+		
+		if (tFilterMode == TextureFilterTrilinear)
+			sampleTexelBytesTrilinear<tSTMode, tWrapDivisor, tComponentCount>(info, texelST, mipLevelBlend(mipLODAtPixel(info, pixelX, pixelY)), pixelBytes);
+		else if (tFilterMode == TextureFilterBilinear)
+			sampleTexelBytesBilinear<tSTMode, tWrapDivisor, tLayout, tComponentCount>(info, texelST, pixelBytes);
+		else if (filterModeResamples(tFilterMode))
+			sampleTexelBytesResampled<tSTMode, tFilterMode, tWrapDivisor, tComponentCount>(info, texelST, pixelBytes);
+		else if (info.texelFractionBits != 0)
+			sampleTexelBytesFixedPoint<tSTMode, tWrapDivisor, tLayout, tComponentCount>(info, texelST, pixelBytes);
+		else
+			sampleTexelBytes<tSTMode, tWrapDivisor, tLayout, tComponentCount>(info, texelST, pixelBytes);
+	}
+#endif
+}
+
+/// genDestSpanBytes_affine() with fixed-point texel coords, for a span where the texel ST is `stBase + pixelX * stPerX`— normalized already when clamping (as it's then only called within one clamp period), or wrapped as it goes.
+/// 	The coords are set (floored from doubles, so an ST just under a wrap or clamp edge stays under it) every kScanlineResyncInterval pixels, at the same pixels whatever the span, and stepped with integer adds in between; so they're within 33 units (of 2^-texelFractionBits texels) of exact: up to 1 from the floor, and half from each of up to 63 rounded steps.
+template<OutsideOfTextureSTMode tSTMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+void genDestSpanBytes_affineFixedPoint(const struct DestImageGenInfo &info, const int startX, const int endX, const GLKVector2 stBase, const GLKVector2 stPerX, UInt8 *rowByteBuffer)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	static const bool kSTWraps = (tSTMode == OutsideOfTextureSTWrap);
+	
+	const int fractionBits = info.texelFractionBits;
+	const int srcMaxIndices[2] = { info.srcWidth_i - 1, info.srcHeight_i - 1 };
+	const int periods[2] = { info.texelWrapPeriods[0].period, info.texelWrapPeriods[1].period };
+	double scales[2];
+	uint32_t coordsPerX[2];
+	for (int axisI = 0; axisI < 2; ++axisI) {
+		scales[axisI] = ldexp(info.srcSize_v2.v[axisI], fractionBits);
+		const int64_t coordPerX = llround(stPerX.v[axisI] * scales[axisI]);
+		coordsPerX[axisI] = kSTWraps ? (uint32_t)fixedPointTexelModulo<tWrapDivisor>(coordPerX, periods[axisI]) : (uint32_t)coordPerX;
+	}
+#if defined(BLIT_KERNELS_AVX512) || defined(BLIT_KERNELS_AVX2) || defined(BLIT_KERNELS_SSE4_1)
+	// each lane's coord offset from the first lane's (a pixel per lane), and from one batch to the next
+	int laneOffsets[2][kSIMDPixelCount];
+	for (int axisI = 0; axisI < 2; ++axisI) {
+		uint32_t laneOffset = 0;
+		for (int laneI = 0; laneI < kSIMDPixelCount; ++laneI) {
+			laneOffsets[axisI][laneI] = (int)laneOffset;
+			laneOffset = stepFixedPointTexelCoord<tSTMode, tWrapDivisor>(laneOffset, coordsPerX[axisI], periods[axisI]);
+		}
+	}
+	const SIMDInts laneOffsetXs = simdLoadInts(laneOffsets[0]), laneOffsetYs = simdLoadInts(laneOffsets[1]);
+	const SIMDInts coordXsPerBatch = simdInts((int)(kSTWraps ? fixedPointTexelModulo<tWrapDivisor>((int64_t)kSIMDPixelCount * coordsPerX[0], periods[0]) : (uint32_t)kSIMDPixelCount * coordsPerX[0])),
+		coordYsPerBatch = simdInts((int)(kSTWraps ? fixedPointTexelModulo<tWrapDivisor>((int64_t)kSIMDPixelCount * coordsPerX[1], periods[1]) : (uint32_t)kSIMDPixelCount * coordsPerX[1]));
+#endif
+	
+	for (int intervalStartX = startX; intervalStartX < endX; ) {
+		const int resyncX = intervalStartX - intervalStartX % kScanlineResyncInterval;
+		const int intervalEndX = (endX - resyncX > kScanlineResyncInterval) ? resyncX + kScanlineResyncInterval : endX;
+		const int stepCount = intervalStartX - resyncX;
+		
+		uint32_t coords[2];
+		for (int axisI = 0; axisI < 2; ++axisI) {
+			double resyncST = (double)stBase.v[axisI] + (double)resyncX * stPerX.v[axisI];
+			if (kSTWraps) {
+				// (wrapped as a double, then stepped up to the span's start if need be; so only the span's first interval needs an integer divide)
+				resyncST -= floor(resyncST);
+				int64_t coord = (int64_t)floor(resyncST * scales[axisI]);
+				if (coord >= periods[axisI])
+					coord -= periods[axisI];
+				if (stepCount > 0)
+					coord = fixedPointTexelModulo<tWrapDivisor>(coord + (int64_t)stepCount * coordsPerX[axisI], periods[axisI]);
+				coords[axisI] = (uint32_t)coord;
+			}
+			else {
+				coords[axisI] = (uint32_t)(int64_t)floor(resyncST * scales[axisI]) + (uint32_t)stepCount * coordsPerX[axisI];
+			}
+		}
+		
+		int pixelX = intervalStartX;
+		UInt8 *pixelBytes = &rowByteBuffer[pixelX * kBytesPerPixel];
+#if defined(BLIT_KERNELS_AVX512) || defined(BLIT_KERNELS_AVX2) || defined(BLIT_KERNELS_SSE4_1)
+		// (the last batch masked to the pixels left, rather than finished a pixel at a time)
+		SIMDInts coordXs = simdStepFixedPointTexelCoords<tSTMode, tWrapDivisor>(simdInts((int)coords[0]), laneOffsetXs, periods[0]),
+			coordYs = simdStepFixedPointTexelCoords<tSTMode, tWrapDivisor>(simdInts((int)coords[1]), laneOffsetYs, periods[1]);
+		for (; pixelX < intervalEndX; pixelX += kSIMDPixelCount, pixelBytes += kSIMDPixelCount * kBytesPerPixel) {
+			const SIMDMask lanesToWrite = (intervalEndX - pixelX >= kSIMDPixelCount) ? simdAllLanes() : simdIntsLessThan(simdLaneIndices(), simdInts(intervalEndX - pixelX));
+			simdCopyTexelsToPixels<tLayout, tComponentCount>(info,
+				simdAffineFixedPointTexelIndices<tSTMode>(coordXs, fractionBits, srcMaxIndices[0]),
+				simdAffineFixedPointTexelIndices<tSTMode>(coordYs, fractionBits, srcMaxIndices[1]),
+				lanesToWrite, pixelBytes
+			);
+			coordXs = simdStepFixedPointTexelCoords<tSTMode, tWrapDivisor>(coordXs, coordXsPerBatch, periods[0]);
+			coordYs = simdStepFixedPointTexelCoords<tSTMode, tWrapDivisor>(coordYs, coordYsPerBatch, periods[1]);
+		}
+#else
+		for (; pixelX < intervalEndX; ++pixelX, pixelBytes += kBytesPerPixel) {
+			const int nearestTexelX = affineFixedPointTexelIndex<tSTMode>(coords[0], fractionBits, srcMaxIndices[0]),
+				nearestTexelY = affineFixedPointTexelIndex<tSTMode>(coords[1], fractionBits, srcMaxIndices[1]);
+			copyBytesToPixelFromTexel<tComponentCount>(pixelBytes, &info.srcBytes[texelIndex<tLayout>(info, nearestTexelX, nearestTexelY) * kBytesPerPixel]);
+			coords[0] = stepFixedPointTexelCoord<tSTMode, tWrapDivisor>(coords[0], coordsPerX[0], periods[0]);
+			coords[1] = stepFixedPointTexelCoord<tSTMode, tWrapDivisor>(coords[1], coordsPerX[1], periods[1]);
+		}
+#endif
+		
+		intervalStartX = intervalEndX;
+	}
+}
+
+/// genDestSpanBytes_affine() with bilinear filtering or resampling, which wrap or clamp each pixel's texels as they sample them (those may straddle a wrap or clamp boundary, so the span isn't split at them).
+template<OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+void genDestSpanBytes_affineFiltered(const struct DestImageGenInfo &info, const int startX, const int endX, const GLKVector2 uvBase, const GLKVector2 uvPerX, UInt8 *rowByteBuffer)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+#if defined(BLIT_KERNELS_AVX512) || defined(BLIT_KERNELS_AVX2) || defined(BLIT_KERNELS_SSE4_1)
+	for (int batchStartX = startX; batchStartX < endX; batchStartX += kSIMDPixelCount) {
+		// (a separate multiply & add per lane, as the scalar path does; lanes past the span are NaNs, so skipped)
+		const SIMDFloats pixelXs = simdToFloats(simdAddInts(simdInts(batchStartX), simdLaneIndices()));
+		const SIMDMask lanesInSpan = simdLessThan(pixelXs, simdFloats(endX));
+		const SIMDFloats texelS = simdSelect(lanesInSpan, simdAdd(simdFloats(uvBase.x), simdMultiply(pixelXs, simdFloats(uvPerX.x))), simdFloats(NAN)),
+			texelT = simdAdd(simdFloats(uvBase.y), simdMultiply(pixelXs, simdFloats(uvPerX.y)));
+		if (tFilterMode == TextureFilterBilinear)
+			simdSampleTexelBytesBilinear<tSTMode, tWrapDivisor, tLayout, tComponentCount>(info, texelS, texelT, &rowByteBuffer[batchStartX * kBytesPerPixel]);
+		else
+			simdSampleTexelBytesResampled<tSTMode, tFilterMode, tWrapDivisor, tComponentCount>(info, texelS, texelT, &rowByteBuffer[batchStartX * kBytesPerPixel]);
+	}
+#else
+	UInt8 *pixelBytes = &rowByteBuffer[startX * kBytesPerPixel];
+	for (int pixelX = startX; pixelX < endX; ++pixelX, pixelBytes += kBytesPerPixel) {
+		const GLKVector2 texelST = GLKVector2Add(uvBase, GLKVector2MultiplyScalar(uvPerX, pixelX));
+		if (tFilterMode == TextureFilterBilinear)
+			sampleTexelBytesBilinear<tSTMode, tWrapDivisor, tLayout, tComponentCount>(info, texelST, pixelBytes);
+		else
+			sampleTexelBytesResampled<tSTMode, tFilterMode, tWrapDivisor, tComponentCount>(info, texelST, pixelBytes);
+	}
+#endif
+}
+
+/// Samples the src along `[startX, endX)` of a dest row where the texel ST is `uvBase + pixelX * uvPerX`.
+/// 	The span is split up-front at the points where the ST crosses a wrap or clamp boundary, so each sub-span samples with a fixed per-axis normalization— no per-pixel `fmodf()`s or clamps.  Sub-spans clamped on both axes (or where the ST doesn't change) are filled with a single texel.
+template<OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+void genDestSpanBytes_affine(const struct DestImageGenInfo &info, const int startX, const int endX, const GLKVector2 uvBase, const GLKVector2 uvPerX, UInt8 *rowByteBuffer)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	static const bool kSTWraps = (tSTMode == OutsideOfTextureSTWrap);
+	
+	if (tFilterMode == TextureFilterBilinear || filterModeResamples(tFilterMode)) {
+		genDestSpanBytes_affineFiltered<tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, startX, endX, uvBase, uvPerX, rowByteBuffer);
+		return;
+	}
+	if (kSTWraps && info.texelFractionBits != 0) {
+		// wrapped in fixed-point as it goes, so not split up
+		genDestSpanBytes_affineFixedPoint<tSTMode, tWrapDivisor, tLayout, tComponentCount>(info, startX, endX, uvBase, uvPerX, rowByteBuffer);
+		return;
+	}
+	
+	const int srcMaxX = info.srcWidth_i - 1, srcMaxY = info.srcHeight_i - 1;
+	for (int subStartX = startX; subStartX < endX; ) {
+		const int subEndXForS = normalizationPeriodEndX(uvBase.x, uvPerX.x, subStartX, endX, kSTWraps),
+			subEndX = normalizationPeriodEndX(uvBase.y, uvPerX.y, subStartX, subEndXForS, kSTWraps);
+		const struct PeriodNormalization
+			normalizationS = periodNormalization(normalizationPeriod(uvBase.x + subStartX * uvPerX.x, kSTWraps), kSTWraps),
+			normalizationT = periodNormalization(normalizationPeriod(uvBase.y + subStartX * uvPerX.y, kSTWraps), kSTWraps);
+		const GLKVector2 texelScale = GLKVector2Make(normalizationS.keep, normalizationT.keep),
+			texelShift = GLKVector2Make(normalizationS.shift, normalizationT.shift);
+		const bool isConstant = (
+			(normalizationS.keep == 0.0f || uvPerX.x == 0.0f) &&
+			(normalizationT.keep == 0.0f || uvPerX.y == 0.0f)
+		);
+		
+		const int sampledEndX = isConstant ? subStartX + 1 : subEndX;
+		int pixelX = subStartX;
+		UInt8 *pixelBytes = &rowByteBuffer[subStartX * kBytesPerPixel];
+		if (info.texelFractionBits != 0) {
+			genDestSpanBytes_affineFixedPoint<tSTMode, tWrapDivisor, tLayout, tComponentCount>(info, subStartX, sampledEndX,
+				GLKVector2Subtract(GLKVector2Multiply(uvBase, texelScale), texelShift), GLKVector2Multiply(uvPerX, texelScale),
+				rowByteBuffer
+			);
+			pixelX = sampledEndX;
+			pixelBytes = &rowByteBuffer[sampledEndX * kBytesPerPixel];
+		}
+#if defined(BLIT_KERNELS_AVX512) || defined(BLIT_KERNELS_AVX2) || defined(BLIT_KERNELS_SSE4_1)
+		if (!isConstant) {
+			for (; pixelX + kSIMDPixelCount <= subEndX; pixelX += kSIMDPixelCount, pixelBytes += kSIMDPixelCount * kBytesPerPixel)
+				simdSampleAffineTexelBytes<tLayout, tComponentCount>(info, pixelX, uvBase, uvPerX, texelScale, texelShift, pixelBytes);
+		}
+#endif
+		for (; pixelX < sampledEndX; ++pixelX, pixelBytes += kBytesPerPixel) {
+			// (a separate multiply & add, as in simdSampleAffineTexelBytes(), rather than one expression the compiler might contract into a fused multiply-add)
+			GLKVector2 uv = GLKVector2Add(uvBase, GLKVector2MultiplyScalar(uvPerX, pixelX));
+			GLKVector2 texelXY = GLKVector2Multiply(GLKVector2Subtract(GLKVector2Multiply(uv, texelScale), texelShift), info.srcSize_v2);
+			// (clamped, in case a coord just under a boundary rounded onto it)
+			int nearestTexelX = clamp_i(nearestTexelIndex(texelXY.x), 0, srcMaxX),
+				nearestTexelY = clamp_i(nearestTexelIndex(texelXY.y), 0, srcMaxY);
+			copyBytesToPixelFromTexel<tComponentCount>(pixelBytes, &info.srcBytes[texelIndex<tLayout>(info, nearestTexelX, nearestTexelY) * kBytesPerPixel]);
+		}
+		if (isConstant) {
+			const UInt8 *texelBytes = &rowByteBuffer[subStartX * kBytesPerPixel];
+			for (; pixelX < subEndX; ++pixelX, pixelBytes += kBytesPerPixel)
+				copyBytesToPixelFromTexel<tComponentCount>(pixelBytes, texelBytes);
+		}
+		
+		subStartX = subEndX;
+	}
+}
+
+/// Affine fast path of genDestImageRowBytes() for when `info.isAffine`.
+/// 	The quad ratios are linear along the row, so `[spanStartX, spanEndX)` is split into sub-spans up-front: for skipping, the one sub-span inside the quad; for wrapping or clamping, sub-spans within which each ratio's normalization (see normalizationPeriod()) is fixed.  Either way each sub-span's UVs are then linear too, and are sampled by genDestSpanBytes_affine() with no per-pixel projection, validity tests, divides, or normalization.
+template<OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+void genDestImageRowBytes_affine(const struct DestImageGenInfo &info, const int pixelY, const int spanStartX, const int spanEndX, UInt8 *rowByteBuffer)
+{
+	static const bool kUVWraps = (tUVMode == OutsideOfQuadUVWrap);
+	
+	const float pixelT = pixelY * info.destSizeReciprocal_v2.y, pixelSPerX = info.destSizeReciprocal_v2.x;
+	const float starToPortRatioRowBase = info.affineStarToPortRatioEdge.y * pixelT + info.affineStarToPortRatioEdge.z,
+		starToPortRatioPerX = info.affineStarToPortRatioEdge.x * pixelSPerX;
+	const float aftToForeRatioRowBase = info.affineAftToForeRatioEdge.y * pixelT + info.affineAftToForeRatioEdge.z,
+		aftToForeRatioPerX = info.affineAftToForeRatioEdge.x * pixelSPerX;
+	
+	const GLKVector2 uvPerStarToPortRatioPerX = GLKVector2MultiplyScalar(info.affineUVPerStarToPortRatio, starToPortRatioPerX),
+		uvPerAftToForeRatioPerX = GLKVector2MultiplyScalar(info.affineUVPerAftToForeRatio, aftToForeRatioPerX);
+	
+	if (tUVMode == OutsideOfQuadUVSkip) {
+		int insideStartX = spanStartX, insideEndX = spanEndX;
+		narrowSpanToLinearInRange0To1(starToPortRatioRowBase, starToPortRatioPerX, &insideStartX, &insideEndX);
+		narrowSpanToLinearInRange0To1(aftToForeRatioRowBase, aftToForeRatioPerX, &insideStartX, &insideEndX);
+		
+		genDestSpanBytes_affine<tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, insideStartX, insideEndX,
+			affineUVFromQuadRatios(info, starToPortRatioRowBase, aftToForeRatioRowBase),
+			GLKVector2Add(uvPerStarToPortRatioPerX, uvPerAftToForeRatioPerX),
+			rowByteBuffer
+		);
+		return;
+	}
+	
+	for (int subStartX = spanStartX; subStartX < spanEndX; ) {
+		const int subEndXForStarToPort = normalizationPeriodEndX(starToPortRatioRowBase, starToPortRatioPerX, subStartX, spanEndX, kUVWraps),
+			subEndX = normalizationPeriodEndX(aftToForeRatioRowBase, aftToForeRatioPerX, subStartX, subEndXForStarToPort, kUVWraps);
+		const struct PeriodNormalization
+			normalizationStarToPort = periodNormalization(normalizationPeriod(starToPortRatioRowBase + subStartX * starToPortRatioPerX, kUVWraps), kUVWraps),
+			normalizationAftToFore = periodNormalization(normalizationPeriod(aftToForeRatioRowBase + subStartX * aftToForeRatioPerX, kUVWraps), kUVWraps);
+		
+		genDestSpanBytes_affine<tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, subStartX, subEndX,
+			affineUVFromQuadRatios(info,
+				starToPortRatioRowBase * normalizationStarToPort.keep - normalizationStarToPort.shift,
+				aftToForeRatioRowBase * normalizationAftToFore.keep - normalizationAftToFore.shift
+			),
+			GLKVector2Add(
+				GLKVector2MultiplyScalar(uvPerStarToPortRatioPerX, normalizationStarToPort.keep),
+				GLKVector2MultiplyScalar(uvPerAftToForeRatioPerX, normalizationAftToFore.keep)
+			),
+			rowByteBuffer
+		);
+		
+		subStartX = subEndX;
+	}
+}
+
+/// @return: The src texel index (along `axisMapping.srcAxis`) read at `surfaceST` along the corresponding dest axis, or -1 if it's skipped per `tUVMode`.
+template<OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode>
+inline int separableTexelIndex(const struct DestImageGenInfo &info, const struct SeparableAxisMapping &axisMapping, const float surfaceST)
+{
+	float ratio = axisMapping.ratioPerST * surfaceST + axisMapping.ratioBase;
+	if (!isTexelCoordNormalizable<tUVMode>(ratio))
+		return -1;
+	normalizeTexelCoord<tUVMode>(ratio);
+	
+	float texelCoord = axisMapping.uv0 + axisMapping.uvPerRatio * ratio;
+	normalizeTexelSTCoord<tSTMode>(texelCoord);
+	return nearestTexelIndex(texelCoord * info.srcSize_v2.v[axisMapping.srcAxis]);
+}
+
+/// Fills `out_srcByteOffsets` with the src byte offset read by each pixel along dest axis `destAxis` (or -1 for skipped pixels).
+template<OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, int tComponentCount>
+void separableSrcByteOffsets(const struct DestImageGenInfo &info, const int destAxis, int *out_srcByteOffsets)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	const struct SeparableAxisMapping &axisMapping = info.separableAxisMappings[destAxis];
+	const int srcBytesPerTexel = (axisMapping.srcAxis == 0) ? kBytesPerPixel : info.srcWidth_i * kBytesPerPixel;
+	const int destLength = (destAxis == 0) ? info.destWidth_i : info.destHeight_i;
+	for (int pixelI = 0; pixelI < destLength; ++pixelI) {
+		int texelI = separableTexelIndex<tUVMode, tSTMode>(info, axisMapping, pixelI * info.destSizeReciprocal_v2.v[destAxis]);
+		out_srcByteOffsets[pixelI] = (texelI < 0) ? -1 : texelI * srcBytesPerTexel;
+	}
+}
+
+/// The per-blit lookup tables for the separable paths, so each tile needn't work them out again.
+/// 	`destXSrcByteOffsets` & `destYSrcByteOffsets` are the src byte offsets read along each dest axis (see separableSrcByteOffsets()), the sum of the two being the texel read.  For dest x reading along src x, `contiguousRunLengths` & `mirroredRunLengths` are how long a run of contiguous src columns (forwards or mirrored) starts at each dest column.
+struct SeparableOffsetTables {
+	int *destXSrcByteOffsets, *destYSrcByteOffsets;
+	int *contiguousRunLengths, *mirroredRunLengths;
+};
+
+template<OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, int tComponentCount>
+void setUpSeparableOffsetTables(const struct DestImageGenInfo &info, struct SeparableOffsetTables &tables)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	const int destWidth = info.destWidth_i, destHeight = info.destHeight_i;
+	tables.destXSrcByteOffsets = (int *)malloc(destWidth * sizeof(int));
+	tables.destYSrcByteOffsets = (int *)malloc(destHeight * sizeof(int));
+	separableSrcByteOffsets<tUVMode, tSTMode, tComponentCount>(info, 0, tables.destXSrcByteOffsets);
+	separableSrcByteOffsets<tUVMode, tSTMode, tComponentCount>(info, 1, tables.destYSrcByteOffsets);
+	
+	tables.contiguousRunLengths = tables.mirroredRunLengths = NULL;
+	if (info.separableAxisMappings[0].srcAxis != 0)
+		return;
+	
+	const int *srcColumnByteOffsets = tables.destXSrcByteOffsets;
+	int *contiguousRunLengths = tables.contiguousRunLengths = (int *)malloc(destWidth * sizeof(int));
+	int *mirroredRunLengths = tables.mirroredRunLengths = (int *)malloc(destWidth * sizeof(int));
+	for (int pixelX = destWidth - 1; pixelX >= 0; --pixelX) {
+		bool continuesRun = (
+			pixelX + 1 < destWidth && srcColumnByteOffsets[pixelX] >= 0 &&
+			srcColumnByteOffsets[pixelX + 1] == srcColumnByteOffsets[pixelX] + kBytesPerPixel
+		);
+		contiguousRunLengths[pixelX] = continuesRun ? contiguousRunLengths[pixelX + 1] + 1 : 1;
+		
+		bool continuesMirroredRun = (
+			pixelX + 1 < destWidth && srcColumnByteOffsets[pixelX + 1] >= 0 &&
+			srcColumnByteOffsets[pixelX + 1] == srcColumnByteOffsets[pixelX] - kBytesPerPixel
+		);
+		mirroredRunLengths[pixelX] = continuesMirroredRun ? mirroredRunLengths[pixelX + 1] + 1 : 1;
+	}
+}
+
+static void freeSeparableOffsetTables(struct SeparableOffsetTables &tables)
+{
+	free(tables.destXSrcByteOffsets);
+	free(tables.destYSrcByteOffsets);
+	free(tables.contiguousRunLengths);
+	free(tables.mirroredRunLengths);
+}
+
+/// Separable fast path of genDestImageRowBytes(), for when `info.isSeparable` with dest x reading along src x (axis-aligned scales, flips & translations, e.g. thumbnails & plain resizes).
+/// 	The row picks its src row and gathers through the column table, `memcpy()`ing the forward runs (which are the whole row at 1:1) and reverse-copying the mirrored ones.
+template<int tComponentCount>
+void genDestImageRowBytes_separable(const struct DestImageGenInfo &info, const struct SeparableOffsetTables &tables, const int pixelY, const int spanStartX, const int spanEndX, UInt8 *rowByteBuffer)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	if (tables.destYSrcByteOffsets[pixelY] < 0)
+		return;
+	
+	const UInt8 *srcRowBytes = &info.srcBytes[tables.destYSrcByteOffsets[pixelY]];
+	for (int pixelX = spanStartX; pixelX < spanEndX; ) {
+		const int srcColumnByteOffset = tables.destXSrcByteOffsets[pixelX];
+		if (srcColumnByteOffset < 0) {
+			++pixelX;
+			continue;
+		}
+		
+		int runLength = tables.contiguousRunLengths[pixelX], mirroredRunLength = tables.mirroredRunLengths[pixelX];
+		if (runLength > 1) {
+			if (runLength > spanEndX - pixelX)
+				runLength = spanEndX - pixelX;
+			memcpy(&rowByteBuffer[pixelX * kBytesPerPixel], &srcRowBytes[srcColumnByteOffset], runLength * kBytesPerPixel);
+			pixelX += runLength;
+		}
+		else {
+			if (mirroredRunLength > spanEndX - pixelX)
+				mirroredRunLength = spanEndX - pixelX;
+			UInt8 *pixelBytes = &rowByteBuffer[pixelX * kBytesPerPixel];
+			const UInt8 *texelBytes = &srcRowBytes[srcColumnByteOffset];
+			for (int runI = 0; runI < mirroredRunLength; ++runI, pixelBytes += kBytesPerPixel, texelBytes -= kBytesPerPixel)
+				copyBytesToPixelFromTexel<tComponentCount>(pixelBytes, texelBytes);
+			pixelX += mirroredRunLength;
+		}
+	}
+}
+
+/// Separable fast path for the dest pixels `[startPixelI, endPixelI)` (in row-major order), for when `info.isSeparable` with dest x reading along src y (90° & 270° rotations, transposes, and scaled versions thereof).
+/// 	Each dest row reads down a src column, so the rows are worked through kCacheBlockSize columns at a time, to keep the src rows being read in cache across the rows.
+template<int tComponentCount>
+void genDestPixelRangeBytes_separableTransposed(const struct DestImageGenInfo &info, const struct SeparableOffsetTables &tables, const int startPixelI, const int endPixelI, UInt8 *byteBuffer)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	const int destWidth = info.destWidth_i;
+	const int startY = startPixelI / destWidth, endY = (endPixelI - 1) / destWidth + 1;
+	const size_t destBytesPerRow = destWidth * kBytesPerPixel;
+	for (int blockX = 0; blockX < destWidth; blockX += kCacheBlockSize) {
+		const int blockEndX = (destWidth - blockX > kCacheBlockSize) ? blockX + kCacheBlockSize : destWidth;
+		for (int pixelY = startY; pixelY < endY; ++pixelY) {
+			const int srcColumnByteOffset = tables.destYSrcByteOffsets[pixelY];
+			if (srcColumnByteOffset < 0)
+				continue;
+			
+			// (the first & last rows may be partly another range's)
+			const int rowStartPixelI = pixelY * destWidth;
+			const int startX = (startPixelI - rowStartPixelI > blockX) ? startPixelI - rowStartPixelI : blockX,
+				endX = (endPixelI - rowStartPixelI < blockEndX) ? endPixelI - rowStartPixelI : blockEndX;
+			
+			const UInt8 *srcColumnBytes = &info.srcBytes[srcColumnByteOffset];
+			UInt8 *destRowBytes = &byteBuffer[pixelY * destBytesPerRow];
+			for (int pixelX = startX; pixelX < endX; ++pixelX) {
+				const int srcRowByteOffset = tables.destXSrcByteOffsets[pixelX];
+				if (srcRowByteOffset >= 0)
+					copyBytesToPixelFromTexel<tComponentCount>(&destRowBytes[pixelX * kBytesPerPixel], &srcColumnBytes[srcRowByteOffset]);
+			}
+		}
+	}
+}
+
+/// Generates a pixel an antialiased edge crosses: sampled at its texel coord clamped into the quad (its sample point possibly being just outside it), and— for the 2- & 4-channel formats— its alpha scaled by its coverage.  A pixel with no coverage is skipped.
+/// @return: The pixel's coverage, in 1/255ths.
+template<QuadMappingMode tMappingMode, OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+int genDestEdgePixelBytes(const struct DestImageGenInfo &info, const int pixelX, const int pixelY, UInt8 *pixelByteBuffer)
+{
+	const int coverage = antialiasedEdgeCoverage(info, pixelX, pixelY);
+	if (coverage == 0)
+		return 0;
+	
+	QuadScanlineEvaluator<tMappingMode, OutsideOfQuadUVClamp> evaluator(info, pixelY, pixelX);
+	const GLKVector2 texelST = evaluator.nextTexelUV();
+	if (GLKVector2IsInvalid(texelST))
+		return 0;
+	
+	sampleTexelBytesFiltered<tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, texelST, pixelX, pixelY, pixelByteBuffer);
+	if (tComponentCount == 2 || tComponentCount == 4) {
+		UInt8 &alpha = pixelByteBuffer[tComponentCount - 1];
+		alpha = (UInt8)((alpha * coverage + 127) / 255);
+	}
+	return coverage;
+}
+
+/// Antialiased-edge path of genDestPixelRangeBytes() for when `info.antialiasesEdges` (so for OutsideOfQuadUVSkip): the pixels of `[spanStartX, spanEndX)` wholly within the quad (see antialiasedRowSpans()) are generated by the usual row paths, and just the ones its edges cross by genDestEdgePixelBytes(); along with the row's coverage in `info.edgeCoverageBytes`, if any.
+/// 	The wholly-covered pixels are mapped as for OutsideOfQuadUVClamp, which comes out the same as skipping for those within the quad— but never skips them, as the bilinear mapping can just within the quad's outline.
+template<QuadMappingMode tMappingMode, OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+void genDestImageRowBytes_antialiased(const struct DestImageGenInfo &info, const int pixelY, const int spanStartX, const int spanEndX, UInt8 *rowByteBuffer)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	int edgeStartX, interiorStartX, interiorEndX, edgeEndX;
+	antialiasedRowSpans(info, pixelY, spanStartX, spanEndX, &edgeStartX, &interiorStartX, &interiorEndX, &edgeEndX);
+	
+	if (interiorStartX < interiorEndX) {
+		if (info.isAffine)
+			genDestImageRowBytes_affine<OutsideOfQuadUVClamp, tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, pixelY, interiorStartX, interiorEndX, rowByteBuffer);
+		else
+			genDestImageRowBytes<tMappingMode, OutsideOfQuadUVClamp, tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, pixelY, interiorStartX, interiorEndX, rowByteBuffer);
+	}
+	
+	UInt8 *rowCoverageBytes = (info.edgeCoverageBytes != NULL) ? &info.edgeCoverageBytes[(size_t)pixelY * info.destWidth_i] : NULL;
+	if (rowCoverageBytes != NULL) {
+		memset(&rowCoverageBytes[spanStartX], 0, edgeStartX - spanStartX);
+		memset(&rowCoverageBytes[interiorStartX], 0xFF, interiorEndX - interiorStartX);
+		memset(&rowCoverageBytes[edgeEndX], 0, spanEndX - edgeEndX);
+	}
+	for (int pixelX = edgeStartX; pixelX < edgeEndX; ++pixelX) {
+		if (pixelX == interiorStartX)
+			pixelX = interiorEndX;
+		if (pixelX == edgeEndX)
+			break;
+		const int coverage = genDestEdgePixelBytes<tMappingMode, tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, pixelX, pixelY, &rowByteBuffer[pixelX * kBytesPerPixel]);
+		if (rowCoverageBytes != NULL)
+			rowCoverageBytes[pixelX] = (UInt8)coverage;
+	}
+}
+
+/// Generates `[startX, endX)` of dest row `pixelY` via whichever row path `info` was set up for (any but the transposed separable one, which works through whole pixel ranges).
+template<QuadMappingMode tMappingMode, OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+inline void genDestRowSpanBytes(const struct DestImageGenInfo &info, const struct SeparableOffsetTables &separableTables, const int pixelY, const int startX, const int endX, UInt8 *rowBytes)
+{
+	if (tUVMode == OutsideOfQuadUVSkip && info.antialiasesEdges)
+		genDestImageRowBytes_antialiased<tMappingMode, tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, pixelY, startX, endX, rowBytes);
+	else if (info.isSeparable)
+		genDestImageRowBytes_separable<tComponentCount>(info, separableTables, pixelY, startX, endX, rowBytes);
+	else if (info.isAffine)
+		genDestImageRowBytes_affine<tUVMode, tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, pixelY, startX, endX, rowBytes);
+	else
+		genDestImageRowBytes<tMappingMode, tUVMode, tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, pixelY, startX, endX, rowBytes);
+}
+
+/// Generates the dest pixels `[startPixelI, endPixelI)` (in row-major order, so possibly starting & ending partway through rows) via whichever path `info` was set up for.
+template<QuadMappingMode tMappingMode, OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+void genDestPixelRangeBytes(const struct DestImageGenInfo &info, const struct SeparableOffsetTables &separableTables, const int startPixelI, const int endPixelI, UInt8 *byteBuffer)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	if (info.isSeparable && info.separableAxisMappings[0].srcAxis != 0) {
+		genDestPixelRangeBytes_separableTransposed<tComponentCount>(info, separableTables, startPixelI, endPixelI, byteBuffer);
+		return;
+	}
+	
+	const int destWidth = info.destWidth_i;
+	const size_t destBytesPerRow = destWidth * kBytesPerPixel;
+	for (int pixelY = startPixelI / destWidth; pixelY * destWidth < endPixelI; ++pixelY) {
+		const int rowStartPixelI = pixelY * destWidth;
+		const int startX = (startPixelI > rowStartPixelI) ? startPixelI - rowStartPixelI : 0,
+			endX = (endPixelI - rowStartPixelI < destWidth) ? endPixelI - rowStartPixelI : destWidth;
+		
+		genDestRowSpanBytes<tMappingMode, tUVMode, tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, separableTables, pixelY, startX, endX, &byteBuffer[pixelY * destBytesPerRow]);
+	}
+}
+
+/// Generates the dest pixels within `[startX, endX)` × `[startY, endY)`, row by row, via whichever row path `info` was set up for (so not the transposed separable one).
+template<QuadMappingMode tMappingMode, OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+void genDestBlockBytes(const struct DestImageGenInfo &info, const struct SeparableOffsetTables &separableTables, const int startX, const int startY, const int endX, const int endY, UInt8 *byteBuffer)
+{
+	static const int kBytesPerPixel = tComponentCount;
+	
+	const size_t destBytesPerRow = info.destWidth_i * kBytesPerPixel;
+	for (int pixelY = startY; pixelY < endY; ++pixelY)
+		genDestRowSpanBytes<tMappingMode, tUVMode, tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, separableTables, pixelY, startX, endX, &byteBuffer[pixelY * destBytesPerRow]);
+}
+
+/// @return: The first pixel index at or after `pixelI` (and before `pixelCount`) whose bytes start a cache line, or `pixelI` itself if none within a cache line's worth of pixels does (as when the buffer or pixel size is oddly aligned).
+static int cacheLineAlignedPixelIndex(const UInt8 *byteBuffer, const int pixelI, const int bytesPerPixel, const int pixelCount)
+{
+	for (int alignedPixelI = pixelI; alignedPixelI < pixelI + kCacheLineSize && alignedPixelI < pixelCount; ++alignedPixelI) {
+		if ((uintptr_t)&byteBuffer[(size_t)alignedPixelI * bytesPerPixel] % kCacheLineSize == 0)
+			return alignedPixelI;
+	}
+	return pixelI;
+}
+
+/// A kTraversalBlockWidth × kTraversalBlockHeight-pixel block of the dest, by its position in blocks.
+struct DestBlock {
+	int x, y;
+};
+
+/// @return: The point `d` steps along the Hilbert curve through the `sideLength` × `sideLength` square (a power of two), which runs from its top-left corner to its top-right, each step to a neighbor of the last.
+static struct DestBlock hilbertCurvePoint(const int sideLength, int d)
+{
+	struct DestBlock point = { 0, 0 };
+	for (int subSideLength = 1; subSideLength < sideLength; subSideLength *= 2, d /= 4) {
+		const int quadrantX = 1 & (d / 2),
+			quadrantY = 1 & (d ^ quadrantX);
+		if (quadrantY == 0) {
+			// the first & last quadrants (the top ones, the curve's ends being along the top) have their sub-curves turned, and the last's mirrored, to enter & leave them next to the middle two
+			if (quadrantX == 1) {
+				point.x = subSideLength - 1 - point.x;
+				point.y = subSideLength - 1 - point.y;
+			}
+			const int x = point.x;
+			point.x = point.y;
+			point.y = x;
+		}
+		point.x += subSideLength * quadrantX;
+		point.y += subSideLength * quadrantY;
+	}
+	return point;
+}
+
+/// @return: The `blockCountX` × `blockCountY` blocks of the dest in the order the Hilbert curve through the smallest power-of-two square around them visits them (so each tile's neighbors in the order are its neighbors in the dest, and each thread's contiguous share of them is compact), in a buffer to be free()d; or NULL where that square is more than kMaxHilbertSquareBlockRatio times their count.
+static struct DestBlock * createHilbertBlockOrder(const int blockCountX, const int blockCountY)
+{
+	int sideLength = 1;
+	while (sideLength < blockCountX || sideLength < blockCountY)
+		sideLength *= 2;
+	const int blockCount = blockCountX * blockCountY;
+	if ((int64_t)sideLength * sideLength > (int64_t)kMaxHilbertSquareBlockRatio * blockCount)
+		return NULL;
+	
+	struct DestBlock *blocks = (struct DestBlock *)malloc(blockCount * sizeof(struct DestBlock));
+	int blockI = 0;
+	for (int d = 0; blockI < blockCount; ++d) {
+		const struct DestBlock block = hilbertCurvePoint(sideLength, d);
+		if (block.x < blockCountX && block.y < blockCountY)
+			blocks[blockI++] = block;
+	}
+	return blocks;
+}
+
+/// @return: Roughly how many src cache lines a dest row reads across, from the mapping's Jacobian at the quad's center: one per src row it crosses, and one per cache line's worth of texels it runs along them.  For the mip chain filters, of the level the center pixel reads (where it spans about a texel); and for OutsideOfQuadUVSkip, just across the quad's width.  0 where the Jacobian can't be found.
+template<QuadMappingMode tMappingMode, OutsideOfQuadUVMode tUVMode, TextureFilterMode tFilterMode, int tComponentCount>
+float destRowSrcCacheLineCount(const struct DestImageGenInfo &info)
+{
+	static const float kTexelsPerCacheLine = (float)kCacheLineSize / tComponentCount;
+	
+	GLKVector2 centerST = GLKVector2Make(0.0f, 0.0f);
+	float minX = INFINITY, maxX = -INFINITY;
+	for (int pointI = 0; pointI < 4; ++pointI) {
+		centerST = GLKVector2Add(centerST, GLKVector2MultiplyScalar(info.points[pointI], 0.25f));
+		minX = fminf(minX, info.points[pointI].x);
+		maxX = fmaxf(maxX, info.points[pointI].x);
+	}
+	struct UVJacobian jacobian;
+	if (!uvJacobianAtSurfaceST<tMappingMode>(info, centerST, &jacobian))
+		return 0.0f;
+	
+	GLKVector2 texelsPerPixelX = GLKVector2Multiply(jacobian.uvPerPixelX, info.srcSize_v2);
+	if (filterModeSamplesMipChain(tFilterMode)) {
+		const float texelsPerPixel = sqrtf(uvJacobianTexelsPerPixelSqr(jacobian, info.srcSize_v2));
+		if (texelsPerPixel > 1.0f)
+			texelsPerPixelX = GLKVector2MultiplyScalar(texelsPerPixelX, 1.0f / texelsPerPixel);
+	}
+	const float rowPixelCount = (tUVMode == OutsideOfQuadUVSkip) ? fminf((maxX - minX) * info.destWidth_i, info.destWidth_i) : info.destWidth_i;
+	return rowPixelCount * (fabsf(texelsPerPixelX.y) + fabsf(texelsPerPixelX.x) / kTexelsPerCacheLine);
+}
+
+/// @return: Whether the dest's rows read across more than kRowTraversalMaxSrcCacheLines src cache lines each (see destRowSrcCacheLineCount()); never so for separable mappings (whose transposed path blocks its own reads, and whose other one reads along src rows).
+template<QuadMappingMode tMappingMode, OutsideOfQuadUVMode tUVMode, TextureFilterMode tFilterMode, int tComponentCount>
+bool destRowsScatterSrcReads(const struct DestImageGenInfo &info)
+{
+	return (!info.isSeparable && destRowSrcCacheLineCount<tMappingMode, tUVMode, tFilterMode, tComponentCount>(info) > kRowTraversalMaxSrcCacheLines);
+}
+
+/// @return: Whether the blit should work through the dest in blocks, per `traversal`: automatically where `rowsScatterSrcReads` (see destRowsScatterSrcReads()); never for separable mappings.
+static bool destTraversesBlocks(const struct DestImageGenInfo &info, const DestTraversal traversal, const bool rowsScatterSrcReads)
+{
+	if (info.isSeparable)
+		return false;
+	switch (traversal) {
+		case DestTraversalRows:
+			return false;
+		case DestTraversalHilbertBlocks:
+			return true;
+		default:
+			return rowsScatterSrcReads;
+	}
+}
+
+/// The dest image split into tiles for the TileWorkerPool: runs of about `tilePixelCount` pixels in row-major order, with each boundary moved onto a cache line boundary (see cacheLineAlignedPixelIndex()) so no two tiles write to the same cache line; or, with `blocks`, one per block, in their order.  (Blocks' edges aren't moved onto cache lines— tiles may share the odd line at them, which is slower but still correct, as they write different bytes of it.)
+struct DestTiles {
+	const struct DestImageGenInfo *info;
+	const struct SeparableOffsetTables *separableTables;
+	UInt8 *byteBuffer;
+	int pixelCount, tilePixelCount, tileCount;
+	/// NULL to go by rows.
+	const struct DestBlock *blocks;
+};
+
+template<int tComponentCount>
+inline int destTileStartPixelIndex(const struct DestTiles &tiles, const int tileI)
+{
+	if (tileI == 0)
+		return 0;
+	if (tileI >= tiles.tileCount)
+		return tiles.pixelCount;
+	return cacheLineAlignedPixelIndex(tiles.byteBuffer, tileI * tiles.tilePixelCount, tComponentCount, tiles.pixelCount);
+}
+
+/// TileWork callback; `context` is a DestTiles.
+template<QuadMappingMode tMappingMode, OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout, int tComponentCount>
+void genDestTileBytes(void *context, int tileI)
+{
+	const struct DestTiles &tiles = *(const struct DestTiles *)context;
+	const struct DestImageGenInfo &info = *tiles.info;
+	// every pixel of a tile that magnifies would just take the bilinear sample (of the src, or the same bytes as mip level 0), so it takes bilinear's kernel outright— with the same output, but without looking up each pixel's footprint, and with the SIMD kernels
+	const struct DestImageGenInfo &bilinearInfo = filterModeSamplesMipChain(tFilterMode) ? info.mipLevelInfos[0] : info;
+	
+	if (tiles.blocks != NULL) {
+		const struct DestBlock &block = tiles.blocks[tileI];
+		const int startX = block.x * kTraversalBlockWidth,
+			startY = block.y * kTraversalBlockHeight,
+			endX = (info.destWidth_i - startX > kTraversalBlockWidth) ? startX + kTraversalBlockWidth : info.destWidth_i,
+			endY = (info.destHeight_i - startY > kTraversalBlockHeight) ? startY + kTraversalBlockHeight : info.destHeight_i;
+		if (filterModeTracksFootprint(tFilterMode) && destRowRangeMagnifies(info, startY, endY))
+			genDestBlockBytes<tMappingMode, tUVMode, tSTMode, TextureFilterBilinear, tWrapDivisor, tLayout, tComponentCount>(bilinearInfo, *tiles.separableTables, startX, startY, endX, endY, tiles.byteBuffer);
+		else
+			genDestBlockBytes<tMappingMode, tUVMode, tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, *tiles.separableTables, startX, startY, endX, endY, tiles.byteBuffer);
+		return;
+	}
+	
+	const int startPixelI = destTileStartPixelIndex<tComponentCount>(tiles, tileI),
+		endPixelI = destTileStartPixelIndex<tComponentCount>(tiles, tileI + 1);
+	if (startPixelI >= endPixelI)
+		return;
+	
+	if (filterModeTracksFootprint(tFilterMode) && destPixelRangeMagnifies(info, startPixelI, endPixelI))
+		genDestPixelRangeBytes<tMappingMode, tUVMode, tSTMode, TextureFilterBilinear, tWrapDivisor, tLayout, tComponentCount>(bilinearInfo, *tiles.separableTables, startPixelI, endPixelI, tiles.byteBuffer);
+	else
+		genDestPixelRangeBytes<tMappingMode, tUVMode, tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount>(info, *tiles.separableTables, startPixelI, endPixelI, tiles.byteBuffer);
+}
+
+UInt8 * defaultDestBufferAllocator(void *_, int pixelCount, size_t bytesPerPixel, bool *out_takeOwnership)
+{
+	UInt8 *byteBuffer = (UInt8 *)calloc(pixelCount, bytesPerPixel); // transparent black-initialized
+	
+	*out_takeOwnership = true;
+	return byteBuffer;
+}
+
+/// Returned image data buffer must be freed with free() by the caller.
+/// 	`tWrapDivisor` must suit the src size (see TexelWrapDivisor); it's ignored when clamping.  TexelLayoutTiled takes `options.tiledSrc`, for the filter modes that read it (see filterModeReadsTiledSrc()).
+template<OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, int tComponentCount, QuadMappingMode tMappingMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout>
+CFDataRef cgTextureMappingBlit(
+	int srcWidth, int srcHeight, CFDataRef srcData,
+	int destWidth, int destHeight,
+	const GLKVector2 points[4], const GLKVector2 pointUVs[4],
+	DestBufferAllocator destBufferAllocator, void *destBufferAllocatorInfo,
+	const CGTextureMappingOptions &options
+)
+{
+	static const size_t kBytesPerPixel = tComponentCount;
+	
+	if (pointUVs == NULL)
+		pointUVs = kDefaultPointUVs;
+	if (destBufferAllocator == NULL)
+		destBufferAllocator = defaultDestBufferAllocator;
+	
+	const size_t srcByteCount = CFDataGetLength(srcData);
+	assertMessage(srcByteCount == ((size_t)srcWidth * srcHeight * kBytesPerPixel),
+		"Byte count of srcData (%zu) must equal the total src bytes (%zu; srcWidth (%d) * srcHeight (%d) * componentCount (%d)).",
+		srcByteCount, ((size_t)srcWidth * srcHeight * kBytesPerPixel), srcWidth, srcHeight, tComponentCount
+	);
+	
+	const UInt8 *srcBytes = CFDataGetBytePtr(srcData);
+	assertMessage(srcBytes != NULL,
+		"Bytes of srcData must come back non-NULL.", NULL
+	);
+	struct DestImageGenInfo info = {
+		srcWidth, srcHeight,
+		/* srcSize_v2: */ GLKVector2Make(srcWidth, srcHeight),
+		srcBytes,
+		destWidth, destHeight,
+		/* destSizeReciprocal_v2: */ GLKVector2Make(1.0f / destWidth, 1.0f / destHeight),
+		/* points union: */ { /* aftStar: */ points[0], /* aftPort: */ points[1], /* foreStar: */ points[2], /* forePort: */ points[3] },
+		/* segmentAftDelta: */ GLKVector2Invalid, /* segmentForeDelta: */ GLKVector2Invalid,
+		/* segmentAftLengthSqr: */ NAN, /* segmentForeLengthSqr: */ NAN,
+		/* pointUVs union: */ { pointUVs[0], pointUVs[1], pointUVs[2], pointUVs[3] },
+	};
+	if (tFilterMode != TextureFilterNearest) {
+		// filtered pixels are sampled at their centers rather than their top-left corners (so a 1:1 mapping reproduces the src, rather than blending each texel with its neighbors); that's the quad moved up & left by half a pixel
+		for (int pointI = 0; pointI < 4; ++pointI)
+			info.points[pointI] = GLKVector2Subtract(info.points[pointI], GLKVector2MultiplyScalar(info.destSizeReciprocal_v2, 0.5f));
+	}
+	info.segmentAftDelta = GLKVector2Subtract(info.pointAftPort, info.pointAftStar);
+	info.segmentForeDelta = GLKVector2Subtract(info.pointForePort, info.pointForeStar);
+	// hack to avoid `… / 0 = NaN` issues:
+	info.segmentAftLengthSqr = GLKVector2AllEqualToScalar(info.segmentAftDelta, 0.0f) ? FLT_MIN : GLKVector2LengthSqr(info.segmentAftDelta);
+	info.segmentForeLengthSqr = GLKVector2AllEqualToScalar(info.segmentForeDelta, 0.0f) ? FLT_MIN : GLKVector2LengthSqr(info.segmentForeDelta);
+	if (tMappingMode == QuadMappingProjective)
+		info.surfaceSTToQuadRatios = surfaceSTToQuadRatiosHomography(info);
+	else if (tMappingMode == QuadMappingBarycentric)
+		setUpBarycentricQuadEdgeFunctions(info);
+	setUpAffineMappingIfParallelogram(info, tMappingMode == QuadMappingBilinear);
+	if (tFilterMode != TextureFilterNearest)
+		info.isSeparable = false; // (the separable paths copy single texels; filtered affine mappings take the affine path)
+	if (filterModeTracksFootprint(tFilterMode))
+		info.isAffine = false; // (the affine path doesn't track each pixel's footprint, so trilinear, EWA & summed-area take the scanline path)
+	if (tUVMode == OutsideOfQuadUVSkip) {
+		setUpCoverageConstraints<tMappingMode>(info);
+		setUpAntialiasedEdges(info, points, options);
+		if (info.antialiasesEdges)
+			info.isSeparable = false; // (the separable paths copy whole spans of texels; antialiased edges need each edge pixel's coverage)
+	}
+	else
+		info.coverageConstraintCount = 0;
+	info.srcTexelIndicesFitInt = ((size_t)srcWidth * srcHeight <= INT_MAX);
+	setUpTexelCoords(info, options.fixedPointFractionBits, tWrapDivisor);
+	if (tFilterMode == TextureFilterEWA)
+		info.maxFilterTapCount = options.maxFilterTapCount;
+	if (filterModeResamples(tFilterMode))
+		info.resamplingWeights = &resamplingFilterWeights((tFilterMode == TextureFilterLanczos3) ? ResamplingKernelLanczos3 : (ResamplingKernel)options.bicubicKernel);
+	if (tFilterMode == TextureFilterSummedArea)
+		info.summedAreaTable = options.summedAreaTable;
+	if (filterModeSamplesMipChain(tFilterMode))
+		setUpMipLevels(info, *options.mipChain, options.fixedPointFractionBits, tWrapDivisor);
+	if (filterModeTracksFootprint(tFilterMode))
+		setUpFootprintGrid<tMappingMode, tFilterMode>(info, options.threadCount);
+	
+	unsigned int pixelCount = destWidth * destHeight;
+	
+	// kinda awesome trick to check that the destBufferAllocator actually changed the value of its `out_takeOwnership` arg
+	union { bool should; uint8_t asUint8; } takeOwnership = { .asUint8 = kInvalidBoolValue };
+	UInt8 *byteBuffer = destBufferAllocator(destBufferAllocatorInfo, pixelCount, kBytesPerPixel, &takeOwnership.should);
+	assertMessage(takeOwnership.asUint8 != kInvalidBoolValue,
+		"The DestBufferAllocator callback's out_takeOwnership arg must be set before returning.", NULL
+	); // you really do have to set the variable
+	
+	struct SeparableOffsetTables separableTables = {};
+	if (info.isSeparable)
+		setUpSeparableOffsetTables<tUVMode, tSTMode, tComponentCount>(info, separableTables);
+	
+	const bool rowsScatterSrcReads = (pixelCount > 0 && destRowsScatterSrcReads<tMappingMode, tUVMode, tFilterMode, tComponentCount>(info));
+	const bool readsTiledSrc = (tLayout == TexelLayoutTiled && rowsScatterSrcReads);
+	if (readsTiledSrc) {
+		// (where the rows read nearer along the src's own rows, they read those in order anyway, faster than across the tiles)
+		const struct CGTextureMappingTiledSrc &tiledSrc = *options.tiledSrc;
+		info.srcBytes = tiledSrc.bytes;
+		info.srcTileRowTexelCount = tiledSrc.tileCountX * kSrcTileTexelCount;
+		info.srcTexelIndicesFitInt = ((size_t)tiledSrc.tileCountX * tiledSrc.tileCountY * kSrcTileTexelCount <= INT_MAX);
+	}
+	
+	struct DestTiles tiles = { &info, &separableTables, byteBuffer, (int)pixelCount };
+	const int blockCountX = (destWidth + kTraversalBlockWidth - 1) / kTraversalBlockWidth,
+		blockCountY = (destHeight + kTraversalBlockHeight - 1) / kTraversalBlockHeight;
+	if (pixelCount > 0 && destTraversesBlocks(info, options.destTraversal, rowsScatterSrcReads))
+		tiles.blocks = createHilbertBlockOrder(blockCountX, blockCountY);
+	if (tiles.blocks != NULL)
+		tiles.tileCount = blockCountX * blockCountY;
+	else {
+		tiles.tilePixelCount = kTilePixelCount;
+		// the transposed separable path reads kCacheBlockSize src rows per pass, so each tile should span at least that many dest rows
+		if (info.isSeparable && info.separableAxisMappings[0].srcAxis != 0 && tiles.tilePixelCount < kCacheBlockSize * destWidth)
+			tiles.tilePixelCount = kCacheBlockSize * destWidth;
+		tiles.tileCount = (tiles.pixelCount + tiles.tilePixelCount - 1) / tiles.tilePixelCount;
+	}
+	// (`tLayout` rather than TexelLayoutTiled, so linear blits don't instantiate the tiled genDestTileBytes() too)
+	TileWork *const genTileBytes = readsTiledSrc ?
+		genDestTileBytes<tMappingMode, tUVMode, tSTMode, tFilterMode, tWrapDivisor, tLayout, tComponentCount> :
+		genDestTileBytes<tMappingMode, tUVMode, tSTMode, tFilterMode, tWrapDivisor, TexelLayoutLinear, tComponentCount>;
+	tileWorkerPoolRun(tiles.tileCount, options.threadCount, genTileBytes, &tiles);
+	
+	free((void *)tiles.blocks);
+	if (info.isSeparable)
+		freeSeparableOffsetTables(separableTables);
+	if (filterModeSamplesMipChain(tFilterMode))
+		freeMipLevels(info);
+	if (filterModeTracksFootprint(tFilterMode))
+		freeFootprintGrid(info);
+	
+	const size_t byteCount = pixelCount * kBytesPerPixel;
+	CFDataRef data = CFDataCreateWithBytesNoCopy(NULL, byteBuffer, byteCount, takeOwnership.should ? kCFAllocatorMalloc : kCFAllocatorNull);
+	return data;
+}
+
+
+#pragma mark Kernel Registration
+
+template<QuadMappingMode tMappingMode, OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor, TexelLayout tLayout>
+void registerBlitKernels(BlitKernel *kernels[kMaxChannelCount])
+{
+	kernels[0] = cgTextureMappingBlit<tUVMode, tSTMode, 1, tMappingMode, tFilterMode, tWrapDivisor, tLayout>;
+	kernels[1] = cgTextureMappingBlit<tUVMode, tSTMode, 2, tMappingMode, tFilterMode, tWrapDivisor, tLayout>;
+	kernels[2] = cgTextureMappingBlit<tUVMode, tSTMode, 3, tMappingMode, tFilterMode, tWrapDivisor, tLayout>;
+	kernels[3] = cgTextureMappingBlit<tUVMode, tSTMode, 4, tMappingMode, tFilterMode, tWrapDivisor, tLayout>;
+}
+template<QuadMappingMode tMappingMode, OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode, TexelWrapDivisor tWrapDivisor>
+void registerBlitKernels(BlitKernel *kernels[kTexelLayoutCount][kMaxChannelCount])
+{
+	// (the filter modes that don't read the tiled src just share their linear kernels)
+	static const TexelLayout kTiledLayout = filterModeReadsTiledSrc(tFilterMode) ? TexelLayoutTiled : TexelLayoutLinear;
+	registerBlitKernels<tMappingMode, tUVMode, tSTMode, tFilterMode, tWrapDivisor, TexelLayoutLinear>(kernels[TexelLayoutLinear]);
+	registerBlitKernels<tMappingMode, tUVMode, tSTMode, tFilterMode, tWrapDivisor, kTiledLayout>(kernels[TexelLayoutTiled]);
+}
+template<QuadMappingMode tMappingMode, OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode, TextureFilterMode tFilterMode>
+void registerBlitKernels(struct BlitKernelTable &table)
+{
+	// (clamping never wraps, so its power-of-two srcs just share the one set of kernels)
+	static const TexelWrapDivisor kPowerOfTwoWrapDivisor = (tSTMode == OutsideOfTextureSTWrap) ? TexelWrapDivisorPowerOfTwo : TexelWrapDivisorMagicNumber;
+	registerBlitKernels<tMappingMode, tUVMode, tSTMode, tFilterMode, TexelWrapDivisorMagicNumber>(table.kernels[tMappingMode][tUVMode][tSTMode][tFilterMode][TexelWrapDivisorMagicNumber]);
+	registerBlitKernels<tMappingMode, tUVMode, tSTMode, tFilterMode, kPowerOfTwoWrapDivisor>(table.kernels[tMappingMode][tUVMode][tSTMode][tFilterMode][TexelWrapDivisorPowerOfTwo]);
+}
+template<QuadMappingMode tMappingMode, OutsideOfQuadUVMode tUVMode, OutsideOfTextureSTMode tSTMode>
+void registerBlitKernels(struct BlitKernelTable &table)
+{
+	registerBlitKernels<tMappingMode, tUVMode, tSTMode, TextureFilterNearest>(table);
+	registerBlitKernels<tMappingMode, tUVMode, tSTMode, TextureFilterBilinear>(table);
+	registerBlitKernels<tMappingMode, tUVMode, tSTMode, TextureFilterTrilinear>(table);
+	registerBlitKernels<tMappingMode, tUVMode, tSTMode, TextureFilterEWA>(table);
+	registerBlitKernels<tMappingMode, tUVMode, tSTMode, TextureFilterBicubic>(table);
+	registerBlitKernels<tMappingMode, tUVMode, tSTMode, TextureFilterLanczos3>(table);
+	registerBlitKernels<tMappingMode, tUVMode, tSTMode, TextureFilterSummedArea>(table);
+}
+template<QuadMappingMode tMappingMode, OutsideOfQuadUVMode tUVMode>
+void registerBlitKernels(struct BlitKernelTable &table)
+{
+	registerBlitKernels<tMappingMode, tUVMode, OutsideOfTextureSTWrap>(table);
+	registerBlitKernels<tMappingMode, tUVMode, OutsideOfTextureSTClamp>(table);
+}
+template<QuadMappingMode tMappingMode>
+void registerBlitKernels(struct BlitKernelTable &table)
+{
+	registerBlitKernels<tMappingMode, OutsideOfQuadUVWrap>(table);
+	registerBlitKernels<tMappingMode, OutsideOfQuadUVClamp>(table);
+	registerBlitKernels<tMappingMode, OutsideOfQuadUVSkip>(table);
+}
+/// Fills `table` with every kernel in this namespace.
+static void registerBlitKernels(struct BlitKernelTable &table)
+{
+	registerBlitKernels<QuadMappingBilinear>(table);
+	registerBlitKernels<QuadMappingProjective>(table);
+	registerBlitKernels<QuadMappingBarycentric>(table);
+	registerBlitKernels<QuadMappingInverseBilinear>(table);
+}
@@ -0,0 +1,36 @@
+#include "CGTextureMappingKernels.h"
+
+
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#if defined(__clang__)
+	#pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#else
+	#pragma GCC push_options
+	#pragma GCC target("avx2")
+#endif
+
+#define BLIT_KERNELS_AVX2
+namespace AVX2BlitKernels {
+	#include "CGTextureMappingKernels.inl"
+}
+
+#if defined(__clang__)
+	#pragma clang attribute pop
+#else
+	#pragma GCC pop_options
+#endif
+
+bool registerAVX2BlitKernels(struct BlitKernelTable &table)
+{
+	AVX2BlitKernels::registerBlitKernels(table);
+	table.isa = CGTextureMappingISAAVX2;
+	return true;
+}
+
+#else
+
+bool registerAVX2BlitKernels(struct BlitKernelTable &table) { return false; }
+
+#endif
@@ -0,0 +1,42 @@
+#include "CGTextureMappingKernels.h"
+
+
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#if defined(__clang__)
+	#pragma clang attribute push (__attribute__((target("avx512f"))), apply_to = function)
+#else
+	#pragma GCC push_options
+	#pragma GCC target("avx512f")
+#endif
+// (AVX-512 brings FMA with it; fusing the kernels' multiply-adds would round differently from the other ISAs' kernels)
+#if defined(__clang__)
+	#pragma STDC FP_CONTRACT OFF
+#else
+	#pragma GCC optimize("fp-contract=off")
+#endif
+
+#define BLIT_KERNELS_AVX512
+namespace AVX512BlitKernels {
+	#include "CGTextureMappingKernels.inl"
+}
+
+#if defined(__clang__)
+	#pragma clang attribute pop
+#else
+	#pragma GCC pop_options
+#endif
+
+bool registerAVX512BlitKernels(struct BlitKernelTable &table)
+{
+	AVX512BlitKernels::registerBlitKernels(table);
+	table.isa = CGTextureMappingISAAVX512;
+	return true;
+}
+
+#else
+
+bool registerAVX512BlitKernels(struct BlitKernelTable &table) { return false; }
+
+#endif
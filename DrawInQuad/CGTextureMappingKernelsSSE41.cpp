@@ -0,0 +1,36 @@
+#include "CGTextureMappingKernels.h"
+
+
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#if defined(__clang__)
+	#pragma clang attribute push (__attribute__((target("sse4.1"))), apply_to = function)
+#else
+	#pragma GCC push_options
+	#pragma GCC target("sse4.1")
+#endif
+
+#define BLIT_KERNELS_SSE4_1
+namespace SSE41BlitKernels {
+	#include "CGTextureMappingKernels.inl"
+}
+
+#if defined(__clang__)
+	#pragma clang attribute pop
+#else
+	#pragma GCC pop_options
+#endif
+
+bool registerSSE41BlitKernels(struct BlitKernelTable &table)
+{
+	SSE41BlitKernels::registerBlitKernels(table);
+	table.isa = CGTextureMappingISASSE41;
+	return true;
+}
+
+#else
+
+bool registerSSE41BlitKernels(struct BlitKernelTable &table) { return false; }
+
+#endif
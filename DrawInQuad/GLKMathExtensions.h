@@ -34,6 +34,66 @@ static inline GLKVector2 GLKVector2Lerp2(GLKVector2 vectorStart, GLKVector2 vect
 /// Slerp (angle and magnitude-lerp) for GLKVector2
 static inline GLKVector2 GLKVector2Slerp(GLKVector2 vectorStart, GLKVector2 vectorEnd, float t);
 
+/// 4 or 8 floats in SIMD registers, one per lane, as GCC/Clang vector extensions: arithmetic operators work lane-by-lane (compiling to NEON, SSE, or AVX, whichever the inlining caller's built for), and comparisons give the matching `GLKIntx*`, all-ones in the lanes where they're true.
+typedef float GLKFloatx4 __attribute__((vector_size(16)));
+typedef int GLKIntx4 __attribute__((vector_size(16)));
+typedef float GLKFloatx8 __attribute__((vector_size(32)));
+typedef int GLKIntx8 __attribute__((vector_size(32)));
+
+/// 4 or 8 GLKVector2s as a structure of arrays, one vector per lane, for the batched (`GLKVector2x4…`/`GLKVector2x8…`) versions of the helpers here.  Each batched helper gives exactly what its single-vector version would for each lane.
+typedef struct GLKVector2x4 { GLKFloatx4 x, y; } GLKVector2x4;
+typedef struct GLKVector2x8 { GLKFloatx8 x, y; } GLKVector2x8;
+
+/// Picks `ifSet`'s lanes where `mask` is all-ones, and `ifClear`'s where it's zero.
+static inline GLKFloatx4 GLKFloatx4Select(GLKIntx4 mask, GLKFloatx4 ifSet, GLKFloatx4 ifClear);
+static inline GLKFloatx8 GLKFloatx8Select(GLKIntx8 mask, GLKFloatx8 ifSet, GLKFloatx8 ifClear);
+
+static inline GLKVector2x4 GLKVector2x4Make(GLKFloatx4 x, GLKFloatx4 y);
+static inline GLKVector2x8 GLKVector2x8Make(GLKFloatx8 x, GLKFloatx8 y);
+/// Transposes an array of GLKVector2s into a batch.
+static inline GLKVector2x4 GLKVector2x4MakeWithArray(const GLKVector2 vectors[4]);
+static inline GLKVector2x8 GLKVector2x8MakeWithArray(const GLKVector2 vectors[8]);
+/// The same vector in every lane.
+static inline GLKVector2x4 GLKVector2x4MakeWithVector(GLKVector2 vector);
+static inline GLKVector2x8 GLKVector2x8MakeWithVector(GLKVector2 vector);
+static inline GLKVector2 GLKVector2x4GetVector(GLKVector2x4 vectors, int laneI);
+static inline GLKVector2 GLKVector2x8GetVector(GLKVector2x8 vectors, int laneI);
+
+/// Batched GLKVector2Add(), GLKVector2Subtract(), GLKVector2Multiply(), GLKVector2MultiplyScalar() & GLKVector2DotProduct().
+static inline GLKVector2x4 GLKVector2x4Add(GLKVector2x4 vectorsLeft, GLKVector2x4 vectorsRight);
+static inline GLKVector2x8 GLKVector2x8Add(GLKVector2x8 vectorsLeft, GLKVector2x8 vectorsRight);
+static inline GLKVector2x4 GLKVector2x4Subtract(GLKVector2x4 vectorsLeft, GLKVector2x4 vectorsRight);
+static inline GLKVector2x8 GLKVector2x8Subtract(GLKVector2x8 vectorsLeft, GLKVector2x8 vectorsRight);
+static inline GLKVector2x4 GLKVector2x4Multiply(GLKVector2x4 vectorsLeft, GLKVector2x4 vectorsRight);
+static inline GLKVector2x8 GLKVector2x8Multiply(GLKVector2x8 vectorsLeft, GLKVector2x8 vectorsRight);
+static inline GLKVector2x4 GLKVector2x4MultiplyScalar(GLKVector2x4 vectors, GLKFloatx4 values);
+static inline GLKVector2x8 GLKVector2x8MultiplyScalar(GLKVector2x8 vectors, GLKFloatx8 values);
+static inline GLKFloatx4 GLKVector2x4DotProduct(GLKVector2x4 vectorsLeft, GLKVector2x4 vectorsRight);
+static inline GLKFloatx8 GLKVector2x8DotProduct(GLKVector2x8 vectorsLeft, GLKVector2x8 vectorsRight);
+
+static inline GLKFloatx4 GLKVector2x4LengthSqr(GLKVector2x4 vectors);
+static inline GLKFloatx8 GLKVector2x8LengthSqr(GLKVector2x8 vectors);
+
+static inline GLKFloatx4 GLKVector2x4DistanceSqr(GLKVector2x4 vectorsStart, GLKVector2x4 vectorsEnd);
+static inline GLKFloatx8 GLKVector2x8DistanceSqr(GLKVector2x8 vectorsStart, GLKVector2x8 vectorsEnd);
+
+/// In SoA form there's nothing to rearrange, so this is just two multiplies & a subtract for all the lanes.
+static inline GLKFloatx4 GLKVector2x4CrossProduct(GLKVector2x4 vectorsLeft, GLKVector2x4 vectorsRight);
+static inline GLKFloatx8 GLKVector2x8CrossProduct(GLKVector2x8 vectorsLeft, GLKVector2x8 vectorsRight);
+
+static inline GLKVector2x4 GLKVector2x4Perp(GLKVector2x4 vectors);
+static inline GLKVector2x8 GLKVector2x8Perp(GLKVector2x8 vectors);
+
+static inline GLKVector2x4 GLKVector2x4Avg2(GLKVector2x4 vectorsA, GLKVector2x4 vectorsB);
+static inline GLKVector2x8 GLKVector2x8Avg2(GLKVector2x8 vectorsA, GLKVector2x8 vectorsB);
+static inline GLKVector2x4 GLKVector2x4Avg3(GLKVector2x4 vectorsA, GLKVector2x4 vectorsB, GLKVector2x4 vectorsC);
+static inline GLKVector2x8 GLKVector2x8Avg3(GLKVector2x8 vectorsA, GLKVector2x8 vectorsB, GLKVector2x8 vectorsC);
+static inline GLKVector2x4 GLKVector2x4Avg4(GLKVector2x4 vectorsA, GLKVector2x4 vectorsB, GLKVector2x4 vectorsC, GLKVector2x4 vectorsD);
+static inline GLKVector2x8 GLKVector2x8Avg4(GLKVector2x8 vectorsA, GLKVector2x8 vectorsB, GLKVector2x8 vectorsC, GLKVector2x8 vectorsD);
+
+static inline GLKVector2x4 GLKVector2x4Lerp2(GLKVector2x4 vectorsStart, GLKVector2x4 vectorsEnd, GLKVector2x4 vectorsT);
+static inline GLKVector2x8 GLKVector2x8Lerp2(GLKVector2x8 vectorsStart, GLKVector2x8 vectorsEnd, GLKVector2x8 vectorsT);
+
 
 
 #include "GLKMathExtensions.inl"
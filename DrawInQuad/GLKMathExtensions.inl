@@ -98,3 +98,190 @@ static inline GLKVector2 GLKVector2Slerp(GLKVector2 vectorStart, GLKVector2 vect
 	);
 	return vector;
 }
+
+
+
+static inline GLKFloatx4 GLKFloatx4Select(GLKIntx4 mask, GLKFloatx4 ifSet, GLKFloatx4 ifClear)
+{
+	return (GLKFloatx4)((mask & (GLKIntx4)ifSet) | (~mask & (GLKIntx4)ifClear));
+}
+static inline GLKFloatx8 GLKFloatx8Select(GLKIntx8 mask, GLKFloatx8 ifSet, GLKFloatx8 ifClear)
+{
+	return (GLKFloatx8)((mask & (GLKIntx8)ifSet) | (~mask & (GLKIntx8)ifClear));
+}
+
+static inline GLKVector2x4 GLKVector2x4Make(GLKFloatx4 x, GLKFloatx4 y)
+{
+	GLKVector2x4 vectors = { x, y };
+	return vectors;
+}
+static inline GLKVector2x8 GLKVector2x8Make(GLKFloatx8 x, GLKFloatx8 y)
+{
+	GLKVector2x8 vectors = { x, y };
+	return vectors;
+}
+
+static inline GLKVector2x4 GLKVector2x4MakeWithArray(const GLKVector2 vectors[4])
+{
+	return GLKVector2x4Make(
+		(GLKFloatx4){ vectors[0].x, vectors[1].x, vectors[2].x, vectors[3].x },
+		(GLKFloatx4){ vectors[0].y, vectors[1].y, vectors[2].y, vectors[3].y }
+	);
+}
+static inline GLKVector2x8 GLKVector2x8MakeWithArray(const GLKVector2 vectors[8])
+{
+	return GLKVector2x8Make(
+		(GLKFloatx8){ vectors[0].x, vectors[1].x, vectors[2].x, vectors[3].x, vectors[4].x, vectors[5].x, vectors[6].x, vectors[7].x },
+		(GLKFloatx8){ vectors[0].y, vectors[1].y, vectors[2].y, vectors[3].y, vectors[4].y, vectors[5].y, vectors[6].y, vectors[7].y }
+	);
+}
+
+static inline GLKVector2x4 GLKVector2x4MakeWithVector(GLKVector2 vector)
+{
+	const GLKFloatx4 zeros = { };
+	return GLKVector2x4Make(zeros + vector.x, zeros + vector.y);
+}
+static inline GLKVector2x8 GLKVector2x8MakeWithVector(GLKVector2 vector)
+{
+	const GLKFloatx8 zeros = { };
+	return GLKVector2x8Make(zeros + vector.x, zeros + vector.y);
+}
+
+static inline GLKVector2 GLKVector2x4GetVector(GLKVector2x4 vectors, int laneI)
+{
+	return GLKVector2Make(vectors.x[laneI], vectors.y[laneI]);
+}
+static inline GLKVector2 GLKVector2x8GetVector(GLKVector2x8 vectors, int laneI)
+{
+	return GLKVector2Make(vectors.x[laneI], vectors.y[laneI]);
+}
+
+static inline GLKVector2x4 GLKVector2x4Add(GLKVector2x4 vectorsLeft, GLKVector2x4 vectorsRight)
+{
+	return GLKVector2x4Make(vectorsLeft.x + vectorsRight.x, vectorsLeft.y + vectorsRight.y);
+}
+static inline GLKVector2x8 GLKVector2x8Add(GLKVector2x8 vectorsLeft, GLKVector2x8 vectorsRight)
+{
+	return GLKVector2x8Make(vectorsLeft.x + vectorsRight.x, vectorsLeft.y + vectorsRight.y);
+}
+
+static inline GLKVector2x4 GLKVector2x4Subtract(GLKVector2x4 vectorsLeft, GLKVector2x4 vectorsRight)
+{
+	return GLKVector2x4Make(vectorsLeft.x - vectorsRight.x, vectorsLeft.y - vectorsRight.y);
+}
+static inline GLKVector2x8 GLKVector2x8Subtract(GLKVector2x8 vectorsLeft, GLKVector2x8 vectorsRight)
+{
+	return GLKVector2x8Make(vectorsLeft.x - vectorsRight.x, vectorsLeft.y - vectorsRight.y);
+}
+
+static inline GLKVector2x4 GLKVector2x4Multiply(GLKVector2x4 vectorsLeft, GLKVector2x4 vectorsRight)
+{
+	return GLKVector2x4Make(vectorsLeft.x * vectorsRight.x, vectorsLeft.y * vectorsRight.y);
+}
+static inline GLKVector2x8 GLKVector2x8Multiply(GLKVector2x8 vectorsLeft, GLKVector2x8 vectorsRight)
+{
+	return GLKVector2x8Make(vectorsLeft.x * vectorsRight.x, vectorsLeft.y * vectorsRight.y);
+}
+
+static inline GLKVector2x4 GLKVector2x4MultiplyScalar(GLKVector2x4 vectors, GLKFloatx4 values)
+{
+	return GLKVector2x4Make(vectors.x * values, vectors.y * values);
+}
+static inline GLKVector2x8 GLKVector2x8MultiplyScalar(GLKVector2x8 vectors, GLKFloatx8 values)
+{
+	return GLKVector2x8Make(vectors.x * values, vectors.y * values);
+}
+
+static inline GLKFloatx4 GLKVector2x4DotProduct(GLKVector2x4 vectorsLeft, GLKVector2x4 vectorsRight)
+{
+	return vectorsLeft.x * vectorsRight.x + vectorsLeft.y * vectorsRight.y;
+}
+static inline GLKFloatx8 GLKVector2x8DotProduct(GLKVector2x8 vectorsLeft, GLKVector2x8 vectorsRight)
+{
+	return vectorsLeft.x * vectorsRight.x + vectorsLeft.y * vectorsRight.y;
+}
+
+static inline GLKFloatx4 GLKVector2x4LengthSqr(GLKVector2x4 vectors)
+{
+	return vectors.x * vectors.x + vectors.y * vectors.y;
+}
+static inline GLKFloatx8 GLKVector2x8LengthSqr(GLKVector2x8 vectors)
+{
+	return vectors.x * vectors.x + vectors.y * vectors.y;
+}
+
+static inline GLKFloatx4 GLKVector2x4DistanceSqr(GLKVector2x4 vectorsStart, GLKVector2x4 vectorsEnd)
+{
+	return GLKVector2x4LengthSqr(GLKVector2x4Subtract(vectorsEnd, vectorsStart));
+}
+static inline GLKFloatx8 GLKVector2x8DistanceSqr(GLKVector2x8 vectorsStart, GLKVector2x8 vectorsEnd)
+{
+	return GLKVector2x8LengthSqr(GLKVector2x8Subtract(vectorsEnd, vectorsStart));
+}
+
+static inline GLKFloatx4 GLKVector2x4CrossProduct(GLKVector2x4 vectorsLeft, GLKVector2x4 vectorsRight)
+{
+	// (as GLKVector2CrossProduct()'s dot product of (left.x, -left.y) & (right.y, right.x))
+	return vectorsLeft.x * vectorsRight.y + -vectorsLeft.y * vectorsRight.x;
+}
+static inline GLKFloatx8 GLKVector2x8CrossProduct(GLKVector2x8 vectorsLeft, GLKVector2x8 vectorsRight)
+{
+	return vectorsLeft.x * vectorsRight.y + -vectorsLeft.y * vectorsRight.x;
+}
+
+static inline GLKVector2x4 GLKVector2x4Perp(GLKVector2x4 vectors)
+{
+	return GLKVector2x4Make(-vectors.y, vectors.x);
+}
+static inline GLKVector2x8 GLKVector2x8Perp(GLKVector2x8 vectors)
+{
+	return GLKVector2x8Make(-vectors.y, vectors.x);
+}
+
+static inline GLKVector2x4 GLKVector2x4Avg2(GLKVector2x4 vectorsA, GLKVector2x4 vectorsB)
+{
+	GLKVector2x4 sums = GLKVector2x4Add(vectorsA, vectorsB);
+	return GLKVector2x4Make(sums.x * 0.5f, sums.y * 0.5f);
+}
+static inline GLKVector2x8 GLKVector2x8Avg2(GLKVector2x8 vectorsA, GLKVector2x8 vectorsB)
+{
+	GLKVector2x8 sums = GLKVector2x8Add(vectorsA, vectorsB);
+	return GLKVector2x8Make(sums.x * 0.5f, sums.y * 0.5f);
+}
+
+static inline GLKVector2x4 GLKVector2x4Avg3(GLKVector2x4 vectorsA, GLKVector2x4 vectorsB, GLKVector2x4 vectorsC)
+{
+	static const float kFloatOneThird = 0.33333333f; // (as in GLKVector2Avg3())
+	
+	GLKVector2x4 sums = GLKVector2x4Add(GLKVector2x4Add(vectorsA, vectorsB), vectorsC);
+	return GLKVector2x4Make(sums.x * kFloatOneThird, sums.y * kFloatOneThird);
+}
+static inline GLKVector2x8 GLKVector2x8Avg3(GLKVector2x8 vectorsA, GLKVector2x8 vectorsB, GLKVector2x8 vectorsC)
+{
+	static const float kFloatOneThird = 0.33333333f; // (as in GLKVector2Avg3())
+	
+	GLKVector2x8 sums = GLKVector2x8Add(GLKVector2x8Add(vectorsA, vectorsB), vectorsC);
+	return GLKVector2x8Make(sums.x * kFloatOneThird, sums.y * kFloatOneThird);
+}
+
+static inline GLKVector2x4 GLKVector2x4Avg4(GLKVector2x4 vectorsA, GLKVector2x4 vectorsB, GLKVector2x4 vectorsC, GLKVector2x4 vectorsD)
+{
+	GLKVector2x4 sums = GLKVector2x4Add(GLKVector2x4Add(GLKVector2x4Add(vectorsA, vectorsB), vectorsC), vectorsD);
+	return GLKVector2x4Make(sums.x * 0.25f, sums.y * 0.25f);
+}
+static inline GLKVector2x8 GLKVector2x8Avg4(GLKVector2x8 vectorsA, GLKVector2x8 vectorsB, GLKVector2x8 vectorsC, GLKVector2x8 vectorsD)
+{
+	GLKVector2x8 sums = GLKVector2x8Add(GLKVector2x8Add(GLKVector2x8Add(vectorsA, vectorsB), vectorsC), vectorsD);
+	return GLKVector2x8Make(sums.x * 0.25f, sums.y * 0.25f);
+}
+
+static inline GLKVector2x4 GLKVector2x4Lerp2(GLKVector2x4 vectorsStart, GLKVector2x4 vectorsEnd, GLKVector2x4 vectorsT)
+{
+	GLKVector2x4 deltas = GLKVector2x4Subtract(vectorsEnd, vectorsStart);
+	return GLKVector2x4Add(vectorsStart, GLKVector2x4Multiply(deltas, vectorsT));
+}
+static inline GLKVector2x8 GLKVector2x8Lerp2(GLKVector2x8 vectorsStart, GLKVector2x8 vectorsEnd, GLKVector2x8 vectorsT)
+{
+	GLKVector2x8 deltas = GLKVector2x8Subtract(vectorsEnd, vectorsStart);
+	return GLKVector2x8Add(vectorsStart, GLKVector2x8Multiply(deltas, vectorsT));
+}
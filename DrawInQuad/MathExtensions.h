@@ -27,6 +27,20 @@ static inline float ratioAlongSegment(GLKVector2 freePoint, GLKVector2 segmentAP
 /// Less-efficient variant— segmentDelta and segmentLengthSqr are calculated on-the-fly
 static inline float ratioAlongSegment(GLKVector2 freePoint, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint);
 
+/// Batched versions of the above for 4 or 8 free points at once (as GLKVector2x4s or GLKVector2x8s), each lane giving exactly what the single-point version would.
+static inline GLKFloatx4 ratioAndNearestPointAlongSegment(GLKVector2x4 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint, GLKVector2 segmentDelta, float segmentLengthSqr, GLKVector2x4 *out_nearestPoints);
+static inline GLKFloatx8 ratioAndNearestPointAlongSegment(GLKVector2x8 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint, GLKVector2 segmentDelta, float segmentLengthSqr, GLKVector2x8 *out_nearestPoints);
+static inline GLKFloatx4 ratioAndNearestPointAlongSegment(GLKVector2x4 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint, GLKVector2x4 *out_nearestPoints);
+static inline GLKFloatx8 ratioAndNearestPointAlongSegment(GLKVector2x8 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint, GLKVector2x8 *out_nearestPoints);
+
+static inline GLKFloatx4 ratioAlongSegment(GLKVector2x4 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint, GLKVector2 segmentDelta, float segmentLengthSqr);
+static inline GLKFloatx8 ratioAlongSegment(GLKVector2x8 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint, GLKVector2 segmentDelta, float segmentLengthSqr);
+static inline GLKFloatx4 ratioAlongSegment(GLKVector2x4 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint);
+static inline GLKFloatx8 ratioAlongSegment(GLKVector2x8 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint);
+/// With a different segment per lane (as when each point's segment is between its own nearest points on two others).
+static inline GLKFloatx4 ratioAlongSegment(GLKVector2x4 freePoints, GLKVector2x4 segmentAPoints, GLKVector2x4 segmentBPoints);
+static inline GLKFloatx8 ratioAlongSegment(GLKVector2x8 freePoints, GLKVector2x8 segmentAPoints, GLKVector2x8 segmentBPoints);
+
 
 
 #include "MathExtensions.inl"
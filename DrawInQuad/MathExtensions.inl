@@ -91,4 +91,88 @@ static inline float ratioAlongSegment(GLKVector2 freePoint, GLKVector2 segmentAP
 	GLKVector2 segmentDelta = GLKVector2Subtract(segmentBPoint, segmentAPoint);
 	float segmentLengthSqr = GLKVector2LengthSqr(segmentDelta); // @warning: potentially zero, causings NaN to get returned
 	return ratioAlongSegment(freePoint, segmentAPoint, segmentBPoint, segmentDelta, segmentLengthSqr);
-}
\ No newline at end of file
+}
+
+static inline GLKFloatx4 ratioAndNearestPointAlongSegment(GLKVector2x4 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint, GLKVector2 segmentDelta, float segmentLengthSqr, GLKVector2x4 *out_nearestPoints)
+{
+	const GLKVector2x4 segmentAPoints = GLKVector2x4MakeWithVector(segmentAPoint), segmentBPoints = GLKVector2x4MakeWithVector(segmentBPoint), segmentDeltas = GLKVector2x4MakeWithVector(segmentDelta);
+	GLKVector2x4 freeToADeltas = GLKVector2x4Subtract(freePoints, segmentAPoints);
+	
+	GLKFloatx4 ratiosAlongSegment = GLKVector2x4DotProduct(freeToADeltas, segmentDeltas) / segmentLengthSqr;
+	
+	// (the point along the segment for every lane, then swapped for the end in the lanes past either end)
+	GLKIntx4 lanesAtA = (ratiosAlongSegment <= 0.0f), lanesAtB = (ratiosAlongSegment >= 1.0f);
+	GLKVector2x4 nearestPoints = GLKVector2x4Add(segmentAPoints, GLKVector2x4MultiplyScalar(segmentDeltas, ratiosAlongSegment));
+	out_nearestPoints->x = GLKFloatx4Select(lanesAtA, segmentAPoints.x, GLKFloatx4Select(lanesAtB, segmentBPoints.x, nearestPoints.x));
+	out_nearestPoints->y = GLKFloatx4Select(lanesAtA, segmentAPoints.y, GLKFloatx4Select(lanesAtB, segmentBPoints.y, nearestPoints.y));
+	
+	return ratiosAlongSegment;
+}
+static inline GLKFloatx8 ratioAndNearestPointAlongSegment(GLKVector2x8 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint, GLKVector2 segmentDelta, float segmentLengthSqr, GLKVector2x8 *out_nearestPoints)
+{
+	const GLKVector2x8 segmentAPoints = GLKVector2x8MakeWithVector(segmentAPoint), segmentBPoints = GLKVector2x8MakeWithVector(segmentBPoint), segmentDeltas = GLKVector2x8MakeWithVector(segmentDelta);
+	GLKVector2x8 freeToADeltas = GLKVector2x8Subtract(freePoints, segmentAPoints);
+	
+	GLKFloatx8 ratiosAlongSegment = GLKVector2x8DotProduct(freeToADeltas, segmentDeltas) / segmentLengthSqr;
+	
+	GLKIntx8 lanesAtA = (ratiosAlongSegment <= 0.0f), lanesAtB = (ratiosAlongSegment >= 1.0f);
+	GLKVector2x8 nearestPoints = GLKVector2x8Add(segmentAPoints, GLKVector2x8MultiplyScalar(segmentDeltas, ratiosAlongSegment));
+	out_nearestPoints->x = GLKFloatx8Select(lanesAtA, segmentAPoints.x, GLKFloatx8Select(lanesAtB, segmentBPoints.x, nearestPoints.x));
+	out_nearestPoints->y = GLKFloatx8Select(lanesAtA, segmentAPoints.y, GLKFloatx8Select(lanesAtB, segmentBPoints.y, nearestPoints.y));
+	
+	return ratiosAlongSegment;
+}
+static inline GLKFloatx4 ratioAndNearestPointAlongSegment(GLKVector2x4 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint, GLKVector2x4 *out_nearestPoints) {
+	GLKVector2 segmentDelta = GLKVector2Subtract(segmentBPoint, segmentAPoint);
+	float segmentLengthSqr = GLKVector2LengthSqr(segmentDelta);
+	return ratioAndNearestPointAlongSegment(freePoints, segmentAPoint, segmentBPoint, segmentDelta, segmentLengthSqr, out_nearestPoints);
+}
+static inline GLKFloatx8 ratioAndNearestPointAlongSegment(GLKVector2x8 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint, GLKVector2x8 *out_nearestPoints) {
+	GLKVector2 segmentDelta = GLKVector2Subtract(segmentBPoint, segmentAPoint);
+	float segmentLengthSqr = GLKVector2LengthSqr(segmentDelta);
+	return ratioAndNearestPointAlongSegment(freePoints, segmentAPoint, segmentBPoint, segmentDelta, segmentLengthSqr, out_nearestPoints);
+}
+
+static inline GLKFloatx4 ratioAlongSegment(GLKVector2x4 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint, GLKVector2 segmentDelta, float segmentLengthSqr)
+{
+	GLKVector2x4 freeToADeltas = GLKVector2x4Subtract(freePoints, GLKVector2x4MakeWithVector(segmentAPoint));
+	
+	GLKFloatx4 ratiosAlongSegment = GLKVector2x4DotProduct(freeToADeltas, GLKVector2x4MakeWithVector(segmentDelta)) / segmentLengthSqr;
+	return ratiosAlongSegment;
+}
+static inline GLKFloatx8 ratioAlongSegment(GLKVector2x8 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint, GLKVector2 segmentDelta, float segmentLengthSqr)
+{
+	GLKVector2x8 freeToADeltas = GLKVector2x8Subtract(freePoints, GLKVector2x8MakeWithVector(segmentAPoint));
+	
+	GLKFloatx8 ratiosAlongSegment = GLKVector2x8DotProduct(freeToADeltas, GLKVector2x8MakeWithVector(segmentDelta)) / segmentLengthSqr;
+	return ratiosAlongSegment;
+}
+static inline GLKFloatx4 ratioAlongSegment(GLKVector2x4 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint) {
+	GLKVector2 segmentDelta = GLKVector2Subtract(segmentBPoint, segmentAPoint);
+	float segmentLengthSqr = GLKVector2LengthSqr(segmentDelta); // @warning: potentially zero, causings NaN to get returned
+	return ratioAlongSegment(freePoints, segmentAPoint, segmentBPoint, segmentDelta, segmentLengthSqr);
+}
+static inline GLKFloatx8 ratioAlongSegment(GLKVector2x8 freePoints, GLKVector2 segmentAPoint, GLKVector2 segmentBPoint) {
+	GLKVector2 segmentDelta = GLKVector2Subtract(segmentBPoint, segmentAPoint);
+	float segmentLengthSqr = GLKVector2LengthSqr(segmentDelta); // @warning: potentially zero, causings NaN to get returned
+	return ratioAlongSegment(freePoints, segmentAPoint, segmentBPoint, segmentDelta, segmentLengthSqr);
+}
+
+static inline GLKFloatx4 ratioAlongSegment(GLKVector2x4 freePoints, GLKVector2x4 segmentAPoints, GLKVector2x4 segmentBPoints)
+{
+	GLKVector2x4 segmentDeltas = GLKVector2x4Subtract(segmentBPoints, segmentAPoints);
+	GLKFloatx4 segmentLengthSqrs = GLKVector2x4LengthSqr(segmentDeltas); // @warning: potentially zero, causings NaN to get returned
+	GLKVector2x4 freeToADeltas = GLKVector2x4Subtract(freePoints, segmentAPoints);
+	
+	GLKFloatx4 ratiosAlongSegment = GLKVector2x4DotProduct(freeToADeltas, segmentDeltas) / segmentLengthSqrs;
+	return ratiosAlongSegment;
+}
+static inline GLKFloatx8 ratioAlongSegment(GLKVector2x8 freePoints, GLKVector2x8 segmentAPoints, GLKVector2x8 segmentBPoints)
+{
+	GLKVector2x8 segmentDeltas = GLKVector2x8Subtract(segmentBPoints, segmentAPoints);
+	GLKFloatx8 segmentLengthSqrs = GLKVector2x8LengthSqr(segmentDeltas); // @warning: potentially zero, causings NaN to get returned
+	GLKVector2x8 freeToADeltas = GLKVector2x8Subtract(freePoints, segmentAPoints);
+	
+	GLKFloatx8 ratiosAlongSegment = GLKVector2x8DotProduct(freeToADeltas, segmentDeltas) / segmentLengthSqrs;
+	return ratiosAlongSegment;
+}
@@ -0,0 +1,192 @@
+#include "TileWorkerPool.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <atomic>
+#include <condition_variable>
+#include <new>
+#include <mutex>
+#include <thread>
+
+
+
+#pragma mark Intermediate Data
+
+/// One thread's remaining share of the tiles, `[begin, end)`, packed into a single word (`begin` in the low half) so the owner taking from the front & thieves taking from the back each need just one compare-and-swap.
+/// 	Each sits on its own cache line, so threads working through their own shares don't contend.
+struct alignas(64) TileRange {
+	std::atomic<uint64_t> beginAndEnd;
+};
+
+static inline uint64_t packTileRange(uint32_t begin, uint32_t end) { return ((uint64_t)end << 32) | begin; }
+static inline uint32_t tileRangeBegin(uint64_t beginAndEnd) { return (uint32_t)beginAndEnd; }
+static inline uint32_t tileRangeEnd(uint64_t beginAndEnd) { return (uint32_t)(beginAndEnd >> 32); }
+
+struct TileWorkerPool {
+	/// Held for the whole of a run, so runs from different calling threads take turns.
+	std::mutex runMutex;
+	
+	/// Guards the run fields below & the workers' waits.
+	std::mutex stateMutex;
+	std::condition_variable runStarted, workerFinished;
+	int workerCount;
+	
+	/// Bumped at the start of each run, so each worker joins each run exactly once.
+	uint64_t runGeneration;
+	int runThreadCount;
+	int runWorkersStillWorking;
+	TileWork *runWork;
+	void *runContext;
+	/// One per thread of the run; thread 0 is the calling thread, and worker `i` is thread `i + 1`.
+	TileRange *runTileRanges;
+	int runTileRangeCapacity;
+};
+
+
+#pragma mark Work Stealing
+
+static bool takeTileFromFront(TileRange &range, int *out_tileI)
+{
+	uint64_t beginAndEnd = range.beginAndEnd.load(std::memory_order_relaxed);
+	for (;;) {
+		const uint32_t begin = tileRangeBegin(beginAndEnd), end = tileRangeEnd(beginAndEnd);
+		if (begin >= end)
+			return false;
+		if (range.beginAndEnd.compare_exchange_weak(beginAndEnd, packTileRange(begin + 1, end), std::memory_order_relaxed)) {
+			*out_tileI = begin;
+			return true;
+		}
+	}
+}
+
+static bool takeTileFromBack(TileRange &range, int *out_tileI)
+{
+	uint64_t beginAndEnd = range.beginAndEnd.load(std::memory_order_relaxed);
+	for (;;) {
+		const uint32_t begin = tileRangeBegin(beginAndEnd), end = tileRangeEnd(beginAndEnd);
+		if (begin >= end)
+			return false;
+		if (range.beginAndEnd.compare_exchange_weak(beginAndEnd, packTileRange(begin, end - 1), std::memory_order_relaxed)) {
+			*out_tileI = end - 1;
+			return true;
+		}
+	}
+}
+
+/// Works through thread `threadI`'s own share, then steals from the others' until every share is empty.
+/// 	(No tiles are added during a run, so once a thread finds every share empty there's nothing left for it to do.)
+static void workTiles(TileWorkerPool &pool, int threadI)
+{
+	const int threadCount = pool.runThreadCount;
+	TileRange *tileRanges = pool.runTileRanges;
+	TileWork *work = pool.runWork;
+	void *context = pool.runContext;
+	
+	for (;;) {
+		int tileI;
+		if (takeTileFromFront(tileRanges[threadI], &tileI)) {
+			work(context, tileI);
+			continue;
+		}
+		
+		bool stoleTile = false;
+		for (int victimOffset = 1; victimOffset < threadCount && !stoleTile; ++victimOffset) {
+			stoleTile = takeTileFromBack(tileRanges[(threadI + victimOffset) % threadCount], &tileI);
+		}
+		if (!stoleTile)
+			return;
+		work(context, tileI);
+	}
+}
+
+static void runWorker(TileWorkerPool *pool, int workerI)
+{
+	const int threadI = workerI + 1;
+	uint64_t joinedRunGeneration = 0;
+	for (;;) {
+		{
+			std::unique_lock<std::mutex> stateLock(pool->stateMutex);
+			pool->runStarted.wait(stateLock, [&]{
+				return pool->runGeneration != joinedRunGeneration && threadI < pool->runThreadCount;
+			});
+			joinedRunGeneration = pool->runGeneration;
+		}
+		
+		workTiles(*pool, threadI);
+		
+		{
+			std::lock_guard<std::mutex> stateLock(pool->stateMutex);
+			if (--pool->runWorkersStillWorking == 0)
+				pool->workerFinished.notify_all();
+		}
+	}
+}
+
+
+#pragma mark Pool
+
+static TileWorkerPool & sharedTileWorkerPool()
+{
+	// never destroyed, as its (detached) threads live for the rest of the process
+	static TileWorkerPool *pool = new TileWorkerPool();
+	return *pool;
+}
+
+int tileWorkerPoolDefaultThreadCount()
+{
+	const unsigned int hardwareThreadCount = std::thread::hardware_concurrency();
+	return (hardwareThreadCount > 0) ? hardwareThreadCount : 1;
+}
+
+void tileWorkerPoolRun(int tileCount, int threadCount, TileWork *work, void *context)
+{
+	if (threadCount <= 0)
+		threadCount = tileWorkerPoolDefaultThreadCount();
+	if (threadCount > tileCount)
+		threadCount = tileCount;
+	if (threadCount <= 1) {
+		for (int tileI = 0; tileI < tileCount; ++tileI)
+			work(context, tileI);
+		return;
+	}
+	
+	TileWorkerPool &pool = sharedTileWorkerPool();
+	std::lock_guard<std::mutex> runLock(pool.runMutex);
+	
+	if (pool.runTileRangeCapacity < threadCount) {
+		// (`new` needn't honor TileRange's cache line alignment)
+		free(pool.runTileRanges);
+		void *tileRangeBytes;
+		posix_memalign(&tileRangeBytes, alignof(TileRange), threadCount * sizeof(TileRange));
+		pool.runTileRanges = (TileRange *)tileRangeBytes;
+		for (int threadI = 0; threadI < threadCount; ++threadI)
+			new (&pool.runTileRanges[threadI]) TileRange();
+		pool.runTileRangeCapacity = threadCount;
+	}
+	for (int threadI = 0; threadI < threadCount; ++threadI) {
+		pool.runTileRanges[threadI].beginAndEnd.store(packTileRange(
+			(int64_t)tileCount * threadI / threadCount,
+			(int64_t)tileCount * (threadI + 1) / threadCount
+		), std::memory_order_relaxed);
+	}
+	
+	{
+		std::lock_guard<std::mutex> stateLock(pool.stateMutex);
+		for (; pool.workerCount < threadCount - 1; ++pool.workerCount)
+			std::thread(runWorker, &pool, pool.workerCount).detach();
+		
+		pool.runThreadCount = threadCount;
+		pool.runWorkersStillWorking = threadCount - 1;
+		pool.runWork = work;
+		pool.runContext = context;
+		++pool.runGeneration;
+	}
+	pool.runStarted.notify_all();
+	
+	workTiles(pool, 0);
+	
+	std::unique_lock<std::mutex> stateLock(pool.stateMutex);
+	pool.workerFinished.wait(stateLock, [&]{
+		return pool.runWorkersStillWorking == 0;
+	});
+}
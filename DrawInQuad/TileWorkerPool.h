@@ -0,0 +1,14 @@
+#pragma once
+
+
+
+/// Work done for a single tile; `context` is whatever was passed to tileWorkerPoolRun().
+typedef void TileWork(void *context, int tileI);
+
+/// Runs `work` once for each tile index in `[0, tileCount)` across up to `threadCount` threads (the calling thread being one of them), returning once every tile is done.
+/// 	The threads are started on first use & kept for later runs.  Each thread is dealt an even, contiguous share of the tiles up-front and works through it from the front; a thread whose share runs out steals from the back of the others', so uneven tile costs (e.g. tiles mostly outside a skipping quad) still balance out.  Runs from several calling threads take turns.
+/// @arg threadCount: 1 to run every tile on the calling thread, or 0 for tileWorkerPoolDefaultThreadCount().
+void tileWorkerPoolRun(int tileCount, int threadCount, TileWork *work, void *context);
+
+/// @return: The number of threads the hardware runs concurrently (at least 1).
+int tileWorkerPoolDefaultThreadCount();
@@ -43,6 +43,18 @@ static NSString *const kLastWrapOutsideOfQuadUVModeKey = @"ViewController_Outsid
 
 static const int kComponentCount = 4;
 
+/// When set, each redraw is also timed at every thread count from 1 to the number of cores (best of kThreadScalingRunCount runs each), to log how the blit scales.
+static const BOOL kLogThreadScaling = NO;
+static const int kThreadScalingRunCount = 5;
+
+/// When set, each redraw is also timed on 1 thread going through the dest by rows & by Hilbert-ordered blocks (best of kTraversalComparisonRunCount runs each), to log which reads the src more cache-friendly for the current quad— rotate it towards 45° to see the rows' src reads fall out of cache.
+static const BOOL kLogTraversalComparison = NO;
+static const int kTraversalComparisonRunCount = 5;
+
+/// When set, each redraw is also timed on 1 thread reading the src's rows & reading a tiled copy of it (best of kTiledSrcComparisonRunCount runs each), to log how much the tiles save for the current quad, and what making them costs.
+static const BOOL kLogTiledSrcComparison = NO;
+static const int kTiledSrcComparisonRunCount = 5;
+
 static const OutsideOfQuadUVMode kDefaultOutsideOfQuadUVMode = OutsideOfQuadUVWrap;
 static NSArray *kOutsideOfQuadUVModeNames;
 
@@ -157,25 +169,7 @@ UInt8 * fetchDestImageBuffer_callback(void *info, int pixelCount, size_t bytesPe
 		
 		uint64_t startTime_nSec = getAccurateSystemTime_nSec();
 		
-		CFDataRef imageData = cgTextureMappingBlit(
-			_srcWidth, _srcHeight, _srcData,
-			_destWidth, _destHeight,
-			(GLKVector2[4]){
-				GLKVector2FromCGPoint(self.point1),
-				GLKVector2FromCGPoint(self.point2),
-				GLKVector2FromCGPoint(self.point3),
-				GLKVector2FromCGPoint(self.point4),
-			},
-			(GLKVector2[4]){
-				(GLKVector2){ .x = 3.0f, .y = 0.0f },
-				(GLKVector2){ .x = 0.0f, .y = 0.0f },
-				(GLKVector2){ .x = 3.0f, .y = 2.0f },
-				(GLKVector2){ .x = 0.0f, .y = 2.0f },
-			},
-			_outsideOfQuadUVMode, OutsideOfTextureSTWrap,
-			4,
-			fetchDestImageBuffer_callback, (__bridge void *)self
-		);
+		CFDataRef imageData = [self blitDestImageDataWithThreadCount:0 traversal:DestTraversalAutomatic tiledSrc:NULL];
 		NSAssert((size_t)CFDataGetLength(imageData) == _destByteCount,
 			@"Number of bytes generated (%zu) does not match calculated total byte count (%zu).",
 			CFDataGetLength(imageData), _destByteCount
@@ -211,10 +205,112 @@ UInt8 * fetchDestImageBuffer_callback(void *info, int pixelCount, size_t bytesPe
 		double elapsedTime_secD = (double)elapsedTime_sec + ((double)elapsedTime_subNSec / kNSecsPerSec);
 		double elapsedTime_mSecD = elapsedTime_secD * 1000;
 		printf("Redrew %d×%d in %fms.\n", width, height, elapsedTime_mSecD);
+		
+		if (kLogThreadScaling)
+			[self logThreadScaling];
+		if (kLogTraversalComparison)
+			[self logTraversalComparison];
+		if (kLogTiledSrcComparison)
+			[self logTiledSrcComparison];
 	}
 	return _destImage;
 }
 
+/// Blits the src into `_destByteBuffer` per the current points & mode.
+/// @arg threadCount: As CGTextureMappingOptions' `threadCount`.
+/// @arg traversal: As CGTextureMappingOptions' `destTraversal`.
+/// @arg tiledSrc: As CGTextureMappingOptions' `tiledSrc`.
+- (CFDataRef)blitDestImageDataWithThreadCount:(int)threadCount traversal:(DestTraversal)traversal tiledSrc:(CGTextureMappingTiledSrcRef)tiledSrc
+{
+	CGTextureMappingOptions options = kDefaultCGTextureMappingOptions;
+	options.threadCount = threadCount;
+	options.destTraversal = traversal;
+	options.tiledSrc = tiledSrc;
+	
+	return cgTextureMappingBlitWithOptions(
+		_srcWidth, _srcHeight, _srcData,
+		_destWidth, _destHeight,
+		(GLKVector2[4]){
+			GLKVector2FromCGPoint(self.point1),
+			GLKVector2FromCGPoint(self.point2),
+			GLKVector2FromCGPoint(self.point3),
+			GLKVector2FromCGPoint(self.point4),
+		},
+		(GLKVector2[4]){
+			(GLKVector2){ .x = 3.0f, .y = 0.0f },
+			(GLKVector2){ .x = 0.0f, .y = 0.0f },
+			(GLKVector2){ .x = 3.0f, .y = 2.0f },
+			(GLKVector2){ .x = 0.0f, .y = 2.0f },
+		},
+		_outsideOfQuadUVMode, OutsideOfTextureSTWrap,
+		kComponentCount,
+		&options,
+		fetchDestImageBuffer_callback, (__bridge void *)self
+	);
+}
+
+- (void)logThreadScaling
+{
+	const int coreCount = (int)NSProcessInfo.processInfo.activeProcessorCount;
+	double singleThreadTime_mSecD = 0.0;
+	for (int threadCount = 1; threadCount <= coreCount; ++threadCount) {
+		uint64_t bestElapsedTime_nSec = UINT64_MAX;
+		for (int runI = 0; runI < kThreadScalingRunCount; ++runI) {
+			uint64_t startTime_nSec = getAccurateSystemTime_nSec();
+			CFRelease([self blitDestImageDataWithThreadCount:threadCount traversal:DestTraversalAutomatic tiledSrc:NULL]);
+			uint64_t elapsedTime_nSec = getAccurateSystemTime_nSec() - startTime_nSec;
+			if (elapsedTime_nSec < bestElapsedTime_nSec)
+				bestElapsedTime_nSec = elapsedTime_nSec;
+		}
+		
+		double elapsedTime_mSecD = (double)bestElapsedTime_nSec * 1000 / kNSecsPerSec;
+		if (threadCount == 1)
+			singleThreadTime_mSecD = elapsedTime_mSecD;
+		printf("\t%d thread(s): %fms (%.2f× of 1 thread's speed).\n", threadCount, elapsedTime_mSecD, singleThreadTime_mSecD / elapsedTime_mSecD);
+	}
+}
+
+- (void)logTraversalComparison
+{
+	const DestTraversal traversals[2] = { DestTraversalRows, DestTraversalHilbertBlocks };
+	double elapsedTimes_mSecD[2];
+	for (int traversalI = 0; traversalI < 2; ++traversalI) {
+		uint64_t bestElapsedTime_nSec = UINT64_MAX;
+		for (int runI = 0; runI < kTraversalComparisonRunCount; ++runI) {
+			uint64_t startTime_nSec = getAccurateSystemTime_nSec();
+			CFRelease([self blitDestImageDataWithThreadCount:1 traversal:traversals[traversalI] tiledSrc:NULL]);
+			uint64_t elapsedTime_nSec = getAccurateSystemTime_nSec() - startTime_nSec;
+			if (elapsedTime_nSec < bestElapsedTime_nSec)
+				bestElapsedTime_nSec = elapsedTime_nSec;
+		}
+		elapsedTimes_mSecD[traversalI] = (double)bestElapsedTime_nSec * 1000 / kNSecsPerSec;
+	}
+	printf("\tRows: %fms; Hilbert blocks: %fms (%.2f× of rows' speed).\n", elapsedTimes_mSecD[0], elapsedTimes_mSecD[1], elapsedTimes_mSecD[0] / elapsedTimes_mSecD[1]);
+}
+
+- (void)logTiledSrcComparison
+{
+	uint64_t startTime_nSec = getAccurateSystemTime_nSec();
+	CGTextureMappingTiledSrcRef tiledSrc = cgTextureMappingTiledSrcCreate(_srcWidth, _srcHeight, _srcData, kComponentCount, 0);
+	double tilingTime_mSecD = (double)(getAccurateSystemTime_nSec() - startTime_nSec) * 1000 / kNSecsPerSec;
+	
+	const CGTextureMappingTiledSrcRef tiledSrcs[2] = { NULL, tiledSrc };
+	double elapsedTimes_mSecD[2];
+	for (int layoutI = 0; layoutI < 2; ++layoutI) {
+		uint64_t bestElapsedTime_nSec = UINT64_MAX;
+		for (int runI = 0; runI < kTiledSrcComparisonRunCount; ++runI) {
+			startTime_nSec = getAccurateSystemTime_nSec();
+			CFRelease([self blitDestImageDataWithThreadCount:1 traversal:DestTraversalAutomatic tiledSrc:tiledSrcs[layoutI]]);
+			uint64_t elapsedTime_nSec = getAccurateSystemTime_nSec() - startTime_nSec;
+			if (elapsedTime_nSec < bestElapsedTime_nSec)
+				bestElapsedTime_nSec = elapsedTime_nSec;
+		}
+		elapsedTimes_mSecD[layoutI] = (double)bestElapsedTime_nSec * 1000 / kNSecsPerSec;
+	}
+	cgTextureMappingTiledSrcRelease(tiledSrc);
+	printf("\tSrc rows: %fms; tiled src: %fms (%.2f× of rows' speed; tiled in %fms).\n", elapsedTimes_mSecD[0], elapsedTimes_mSecD[1], elapsedTimes_mSecD[0] / elapsedTimes_mSecD[1], tilingTime_mSecD);
+}
+
 - (void)generateSrcPossibilities
 {
 	NSMutableArray *srcPossibilityNames = [[NSMutableArray alloc] initWithArray:[NSBundle.mainBundle pathsForResourcesOfType:@"png" inDirectory:@""]];